@@ -1,6 +1,13 @@
 #include <benchmark/benchmark.h>
 #include <vector>
+#include <deque>
 #include "Heph/Buffers/Buffer.h"
+#include "Heph/Buffers/ArithmeticBuffer.h"
+#include "Heph/Buffers/CircularBuffer.h"
+#include "Heph/Buffers/SPSCRingBuffer.h"
+#include <thread>
+#include <mutex>
+#include "Heph/Buffers/Iterators/CircularBufferIterator.h"
 
 using namespace Heph;
 using test_data_t = int;
@@ -10,7 +17,7 @@ template<
     size_t NDimensions,
     template<typename, size_t> typename TIterator = BufferIterator
 >
-    requires (NDimensions > 0 && NDimensions <= 2)
+    requires (NDimensions > 0 && NDimensions <= 4)
 class TestBuffer : public Buffer<test_data_t, NDimensions, TIterator>
 {
 public:
@@ -236,6 +243,27 @@ static void BM_VectorAccess1D(benchmark::State& state)
 }
 BENCHMARK(BM_VectorAccess1D)->Unit(TIME_UNIT)->Arg(1e6);
 
+template<template<typename, size_t> typename TIterator>
+static void BM_BufferCircularAccess1D(benchmark::State& state)
+{
+    TestBuffer<1, TIterator> b(1024);
+    size_t count = state.range(0);
+
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(count);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            benchmark::DoNotOptimize(b[i]);
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(BM_BufferCircularAccess1D<CircularBufferIterator>)->Unit(TIME_UNIT)->Arg(1e6);
+BENCHMARK(BM_BufferCircularAccess1D<PowerOfTwoCircularBufferIterator>)->Unit(TIME_UNIT)->Arg(1e6);
+
 static void BM_BufferAtAccess1D(benchmark::State& state)
 {
     TestBuffer<1> b(state.range(0));
@@ -316,6 +344,28 @@ static void BM_VectorItAccess1D(benchmark::State& state)
 }
 BENCHMARK(BM_VectorItAccess1D)->Unit(TIME_UNIT)->Arg(1e6);
 
+static void BM_BufferItAccess3D(benchmark::State& state)
+{
+    const size_t n = state.range(0);
+    TestBuffer<3> b(n, n, n);
+    auto itBegin = b.begin();
+    auto itEnd = b.end();
+
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(itBegin);
+    benchmark::DoNotOptimize(itEnd);
+
+    for (auto _ : state)
+    {
+        for (auto it = itBegin; it != itEnd; ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+            benchmark::ClobberMemory();
+        }
+    }
+}
+BENCHMARK(BM_BufferItAccess3D)->Unit(TIME_UNIT)->Arg(100);
+
 static void BM_BufferShiftLeft(benchmark::State& state)
 {
     TestBuffer<1> b(state.range(0));
@@ -331,6 +381,45 @@ static void BM_BufferShiftLeft(benchmark::State& state)
 }
 BENCHMARK(BM_BufferShiftLeft)->Unit(TIME_UNIT)->Arg(1e6);
 
+static void BM_BufferShiftStreamFrames(benchmark::State& state)
+{
+    constexpr size_t frameSize = 256;
+    TestBuffer<1> history(state.range(0));
+    const TestBuffer<1> frame(frameSize);
+
+    benchmark::DoNotOptimize(history);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < 100; ++i)
+        {
+            history <<= frameSize;
+            history.Replace(frame, history.Size() - frameSize, 0, frameSize);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_BufferShiftStreamFrames)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_CircularBufferStreamFrames(benchmark::State& state)
+{
+    constexpr size_t frameSize = 256;
+    CircularBuffer<test_data_t> history(state.range(0), CircularBufferOverflowMode::OverwriteOldest);
+    const TestBuffer<1> frame(frameSize);
+
+    benchmark::DoNotOptimize(history);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < 100; ++i)
+        {
+            history.Push(frame.View());
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_CircularBufferStreamFrames)->Unit(TIME_UNIT)->Arg(1e6);
+
 static void BM_VectorShiftLeft(benchmark::State& state)
 {
     std::vector<test_data_t> v(state.range(0));
@@ -440,6 +529,45 @@ static void BM_VectorPrepend(benchmark::State& state)
 }
 BENCHMARK(BM_VectorPrepend)->Unit(TIME_UNIT)->Arg(1e6);
 
+static void BM_BufferPrependFrames(benchmark::State& state)
+{
+    TestBuffer<1> frame(state.range(1));
+
+    benchmark::DoNotOptimize(frame);
+
+    for (auto _ : state)
+    {
+        TestBuffer<1> b;
+        for (size_t i = 0; i < state.range(0); i += frame.Size())
+        {
+            b.Prepend(frame);
+        }
+        benchmark::DoNotOptimize(b);
+        benchmark::ClobberMemory();
+    }
+}
+// frames of 255 and 1 elements are not a multiple of the aligned step, hence the first element is unaligned after most prepends
+BENCHMARK(BM_BufferPrependFrames)->Unit(TIME_UNIT)->Args({ 1'000'000, 256 })->Args({ 1'000'000, 255 })->Args({ 1'000'000, 1 });
+
+static void BM_DequePrependFrames(benchmark::State& state)
+{
+    std::vector<test_data_t> frame(256);
+
+    benchmark::DoNotOptimize(frame);
+
+    for (auto _ : state)
+    {
+        std::deque<test_data_t> d;
+        for (size_t i = 0; i < state.range(0); i += frame.size())
+        {
+            d.insert(d.begin(), frame.begin(), frame.end());
+        }
+        benchmark::DoNotOptimize(d);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_DequePrependFrames)->Unit(TIME_UNIT)->Arg(1e6);
+
 static void BM_BufferAppend(benchmark::State& state)
 {
     TestBuffer<1> b1(state.range(0));
@@ -472,6 +600,44 @@ static void BM_VectorAppend(benchmark::State& state)
 }
 BENCHMARK(BM_VectorAppend)->Unit(TIME_UNIT)->Arg(1e6);
 
+static void BM_BufferAppendFrames(benchmark::State& state)
+{
+    TestBuffer<1> frame(256);
+
+    benchmark::DoNotOptimize(frame);
+
+    for (auto _ : state)
+    {
+        TestBuffer<1> b;
+        for (size_t i = 0; i < state.range(0); i += frame.Size())
+        {
+            b.Append(frame);
+        }
+        benchmark::DoNotOptimize(b);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_BufferAppendFrames)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_VectorAppendFrames(benchmark::State& state)
+{
+    std::vector<test_data_t> frame(256);
+
+    benchmark::DoNotOptimize(frame);
+
+    for (auto _ : state)
+    {
+        std::vector<test_data_t> v;
+        for (size_t i = 0; i < state.range(0); i += frame.size())
+        {
+            v.insert(v.end(), frame.begin(), frame.end());
+        }
+        benchmark::DoNotOptimize(v);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_VectorAppendFrames)->Unit(TIME_UNIT)->Arg(1e6);
+
 static void BM_BufferInsert(benchmark::State& state)
 {
     TestBuffer<1> b1(state.range(0));
@@ -502,4 +668,404 @@ static void BM_VectorInsert(benchmark::State& state)
         benchmark::ClobberMemory();
     }
 }
-BENCHMARK(BM_VectorInsert)->Unit(TIME_UNIT)->Arg(1e6);
\ No newline at end of file
+BENCHMARK(BM_VectorInsert)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_BufferTranspose2D(benchmark::State& state)
+{
+    const size_t n = state.range(0);
+    TestBuffer<2> b(n, n);
+
+    for (auto _ : state)
+    {
+        b.Transpose(TransposeMode::Normal, 1, 0);
+        benchmark::DoNotOptimize(b.begin());
+    }
+}
+BENCHMARK(BM_BufferTranspose2D)->Unit(TIME_UNIT)->Arg(2048);
+
+static void BM_BufferTranspose3D(benchmark::State& state)
+{
+    const size_t n = state.range(0);
+    TestBuffer<3> b(n, n, n);
+
+    for (auto _ : state)
+    {
+        b.Transpose(TransposeMode::Normal, 2, 0, 1);
+        benchmark::DoNotOptimize(b.begin());
+    }
+}
+BENCHMARK(BM_BufferTranspose3D)->Unit(TIME_UNIT)->Arg(160);
+
+static void BM_BufferTranspose4D(benchmark::State& state)
+{
+    const size_t n = state.range(0);
+    TestBuffer<4> b(n, n, n, n);
+
+    for (auto _ : state)
+    {
+        b.Transpose(TransposeMode::Normal, 3, 1, 2, 0);
+        benchmark::DoNotOptimize(b.begin());
+    }
+}
+BENCHMARK(BM_BufferTranspose4D)->Unit(TIME_UNIT)->Arg(64);
+
+static void BM_SPSCRingBufferStream(benchmark::State& state)
+{
+    static constexpr size_t frameSize = 256;
+    const size_t elementCount = state.range(0);
+
+    for (auto _ : state)
+    {
+        SPSCRingBuffer<test_data_t> rb(4096);
+
+        std::thread producer([&rb, elementCount]()
+            {
+                const TestBuffer<1> frame(frameSize);
+                for (size_t written = 0; written < elementCount;)
+                {
+                    const size_t n = rb.Write(frame.Slice(0, 0, std::min(frameSize, elementCount - written)));
+                    if (n == 0) std::this_thread::yield();
+                    written += n;
+                }
+            });
+
+        TestBuffer<1> frame(frameSize);
+        for (size_t read = 0; read < elementCount;)
+        {
+            const size_t n = rb.Read(frame.View());
+            if (n == 0) std::this_thread::yield();
+            read += n;
+        }
+
+        producer.join();
+        benchmark::DoNotOptimize(frame);
+    }
+
+    state.SetItemsProcessed(state.iterations() * elementCount);
+}
+BENCHMARK(BM_SPSCRingBufferStream)->Unit(TIME_UNIT)->Arg(1e6)->UseRealTime();
+
+static void BM_MutexCircularBufferStream(benchmark::State& state)
+{
+    static constexpr size_t frameSize = 256;
+    const size_t elementCount = state.range(0);
+
+    for (auto _ : state)
+    {
+        CircularBuffer<test_data_t> cb(4096);
+        std::mutex mutex;
+
+        std::thread producer([&cb, &mutex, elementCount]()
+            {
+                const TestBuffer<1> frame(frameSize);
+                for (size_t written = 0; written < elementCount;)
+                {
+                    size_t n;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        n = cb.Push(frame.Slice(0, 0, std::min(frameSize, elementCount - written)));
+                    }
+                    if (n == 0) std::this_thread::yield();
+                    written += n;
+                }
+            });
+
+        TestBuffer<1> frame(frameSize);
+        for (size_t read = 0; read < elementCount;)
+        {
+            size_t n;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                n = cb.Pop(frame.View());
+            }
+            if (n == 0) std::this_thread::yield();
+            read += n;
+        }
+
+        producer.join();
+        benchmark::DoNotOptimize(frame);
+    }
+
+    state.SetItemsProcessed(state.iterations() * elementCount);
+}
+BENCHMARK(BM_MutexCircularBufferStream)->Unit(TIME_UNIT)->Arg(1e6)->UseRealTime();
+
+static void BM_ArithmeticBufferChain(benchmark::State& state)
+{
+    ArithmeticBuffer<double> a(state.range(0));
+    ArithmeticBuffer<double> b(state.range(0));
+    ArithmeticBuffer<double> c(state.range(0));
+    constexpr double g = 0.5;
+
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+    benchmark::DoNotOptimize(c);
+
+    for (auto _ : state)
+    {
+        ArithmeticBuffer<double> result = a * g + b - c;
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArithmeticBufferChain)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_RealBufferAddAssign(benchmark::State& state)
+{
+    RealBuffer a(state.range(0));
+    RealBuffer b(state.range(0));
+
+    benchmark::DoNotOptimize(b);
+
+    for (auto _ : state)
+    {
+        a += b;
+        a *= 0.5;
+        benchmark::DoNotOptimize(a);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RealBufferAddAssign)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_ComplexBufferMultiplyAssign(benchmark::State& state)
+{
+    ComplexBuffer a(state.range(0));
+    ComplexBuffer b(state.range(0));
+
+    benchmark::DoNotOptimize(b);
+
+    for (auto _ : state)
+    {
+        a *= b;
+        a *= std::complex<double>(0.5, 0.25);
+        benchmark::DoNotOptimize(a);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComplexBufferMultiplyAssign)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_RealBufferReductions(benchmark::State& state)
+{
+    RealBuffer a(state.range(0));
+    for (size_t i = 0; i < a.ElementCount(); ++i)
+        a[i] = static_cast<double>(i % 1000) * 0.001 - 0.5;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a.Min());
+        benchmark::DoNotOptimize(a.Max());
+        benchmark::DoNotOptimize(a.AbsMax());
+        benchmark::DoNotOptimize(a.Rms());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(BM_RealBufferReductions)->Unit(TIME_UNIT)->Arg(1e7);
+
+static void BM_RealBufferStatistics(benchmark::State& state)
+{
+    RealBuffer a(state.range(0));
+    for (size_t i = 0; i < a.ElementCount(); ++i)
+        a[i] = static_cast<double>(i % 1000) * 0.001 - 0.5;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a.Statistics());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(BM_RealBufferStatistics)->Unit(TIME_UNIT)->Arg(1e7);
+
+static void BM_BufferAxisRms(benchmark::State& state)
+{
+    constexpr size_t channelCount = 8;
+    ArithmeticBuffer<double, 2> a(state.range(0), channelCount);
+    for (size_t i = 0; i < a.Size(0); ++i)
+        for (size_t j = 0; j < channelCount; ++j)
+            a[i, j] = static_cast<double>((i + j) % 1000) * 0.001 - 0.5;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a.Rms(0));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * channelCount);
+}
+BENCHMARK(BM_BufferAxisRms)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_BufferAxisRmsIndexed(benchmark::State& state)
+{
+    constexpr size_t channelCount = 8;
+    ArithmeticBuffer<double, 2> a(state.range(0), channelCount);
+    for (size_t i = 0; i < a.Size(0); ++i)
+        for (size_t j = 0; j < channelCount; ++j)
+            a[i, j] = static_cast<double>((i + j) % 1000) * 0.001 - 0.5;
+
+    for (auto _ : state)
+    {
+        RealBuffer rms(channelCount);
+        for (size_t j = 0; j < channelCount; ++j)
+        {
+            double sum = 0;
+            for (size_t i = 0; i < a.Size(0); ++i) sum += a[i, j] * a[i, j];
+            rms[j] = std::sqrt(sum / a.Size(0));
+        }
+        benchmark::DoNotOptimize(rms);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * channelCount);
+}
+BENCHMARK(BM_BufferAxisRmsIndexed)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_BufferBroadcastGain(benchmark::State& state)
+{
+    constexpr size_t channelCount = 8;
+    ArithmeticBuffer<double, 2> a(state.range(0), channelCount);
+    const RealBuffer gains = { 0.5, 0.6, 0.7, 0.8, 1.2, 1.3, 1.4, 1.5 };
+
+    for (auto _ : state)
+    {
+        a *= gains;
+        benchmark::DoNotOptimize(a);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * channelCount);
+}
+BENCHMARK(BM_BufferBroadcastGain)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_BufferExpandedGain(benchmark::State& state)
+{
+    constexpr size_t channelCount = 8;
+    ArithmeticBuffer<double, 2> a(state.range(0), channelCount);
+    ArithmeticBuffer<double, 2> gains(state.range(0), channelCount);
+    for (size_t i = 0; i < a.Size(0); ++i)
+        for (size_t j = 0; j < channelCount; ++j)
+            gains[i, j] = 0.5 + j * 0.1;
+
+    for (auto _ : state)
+    {
+        a *= gains;
+        benchmark::DoNotOptimize(a);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * channelCount);
+}
+BENCHMARK(BM_BufferExpandedGain)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_RealBufferAdd(benchmark::State& state)
+{
+    RealBuffer a(state.range(0));
+    RealBuffer b(state.range(0));
+
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+
+    for (auto _ : state)
+    {
+        RealBuffer result = a + b;
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RealBufferAdd)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_RealBufferRvalueChain(benchmark::State& state)
+{
+    RealBuffer a(state.range(0));
+    RealBuffer b(state.range(0));
+
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+
+    for (auto _ : state)
+    {
+        RealBuffer result = RealBuffer(a + b) * 0.5 - b;
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RealBufferRvalueChain)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_BufferApply(benchmark::State& state)
+{
+    constexpr size_t channelCount = 8;
+    ArithmeticBuffer<double, 2> a(state.range(0), channelCount);
+
+    for (auto _ : state)
+    {
+        a.Apply([](double x) { return x / (1.0 + std::abs(x)) + 0.25; });
+        benchmark::DoNotOptimize(a);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * channelCount);
+}
+BENCHMARK(BM_BufferApply)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_BufferApplyIterator(benchmark::State& state)
+{
+    constexpr size_t channelCount = 8;
+    ArithmeticBuffer<double, 2> a(state.range(0), channelCount);
+
+    for (auto _ : state)
+    {
+        for (double& element : a) element = element / (1.0 + std::abs(element)) + 0.25;
+        benchmark::DoNotOptimize(a);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * channelCount);
+}
+BENCHMARK(BM_BufferApplyIterator)->Unit(TIME_UNIT)->Arg(1e6);
+
+static void BM_ParallelForDispatch(benchmark::State& state)
+{
+    // many short loops, which measures the cost of handing chunks to threads
+    Parallel::SetThreadCount(4);
+    std::vector<double> v(state.range(0), 1.0);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < 100; ++i)
+        {
+            Parallel::For(0, v.size(), v.size() / 4, [&v](size_t begin, size_t end)
+                {
+                    for (size_t j = begin; j < end; ++j) v[j] *= 1.0000001;
+                });
+        }
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+
+    Parallel::SetThreadCount(0);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+BENCHMARK(BM_ParallelForDispatch)->Unit(TIME_UNIT)->Arg(1 << 14);
+
+template<typename TPolicy>
+static void BM_BufferTransposePolicy(benchmark::State& state)
+{
+    ArithmeticBuffer<double, 2> a(state.range(0), state.range(0));
+
+    for (auto _ : state)
+    {
+        a.Transpose(TPolicy(), TransposeMode::Normal, 1, 0);
+        benchmark::DoNotOptimize(a);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_BufferTransposePolicy<SequencedPolicy>)->Unit(TIME_UNIT)->Arg(2048);
+BENCHMARK(BM_BufferTransposePolicy<ParallelPolicy>)->Unit(TIME_UNIT)->Arg(2048);
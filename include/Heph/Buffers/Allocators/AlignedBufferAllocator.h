@@ -0,0 +1,179 @@
+#ifndef HEPH_ALIGNED_BUFFER_ALLOCATOR_H
+#define HEPH_ALIGNED_BUFFER_ALLOCATOR_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/Allocators/BufferAllocatorConcept.h"
+#include "Heph/Exceptions/InsufficientMemoryException.h"
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+#include <cstddef>
+#include <format>
+
+/** @file */
+
+/**
+ * @brief Default alignment, in bytes, of the memory allocated for buffers.
+ * Define before including Heph headers to change it. Must be a power of 2.
+ */
+#ifndef HEPH_BUFFER_ALIGNMENT
+#define HEPH_BUFFER_ALIGNMENT 64
+#endif
+
+namespace Heph
+{
+    /**
+     * @brief Allocator that returns memory aligned to the provided boundary,
+     * keeps the alignment when the memory is reallocated.
+     *
+     * @tparam T Type of the elements to allocate.
+     * @tparam Alignment Alignment of the memory in bytes. Must be a power of 2.
+     */
+    template<typename T, size_t Alignment = HEPH_BUFFER_ALIGNMENT>
+        requires (std::has_single_bit(Alignment) && Alignment >= alignof(T))
+    class HEPH_API AlignedBufferAllocator final
+    {
+    public:
+        /** @brief Type of the elements to allocate. */
+        using value_type = T;
+        /** @brief Type of the element count. */
+        using size_type = size_t;
+        /** @brief Type of the pointer difference. */
+        using difference_type = std::ptrdiff_t;
+        /** @brief Specifies that the allocator is moved along with the memory it allocated. */
+        using propagate_on_container_move_assignment = std::true_type;
+        /** @brief Specifies that any two instances can deallocate each other's memory. */
+        using is_always_equal = std::true_type;
+
+        /** @brief Provides the allocator type for another element type. */
+        template<typename U>
+        struct rebind
+        {
+            /** @brief Allocator type for ``U``. */
+            using other = AlignedBufferAllocator<U, Alignment>;
+        };
+
+        /** @brief Alignment of the memory in bytes. */
+        static constexpr size_t alignment = std::max(Alignment, sizeof(void*));
+
+    public:
+        /** @copydoc default_constructor */
+        constexpr AlignedBufferAllocator() noexcept = default;
+
+        /**
+         * @copydoc constructor
+         *
+         * @param rhs Allocator of another element type.
+         */
+        template<typename U>
+        constexpr AlignedBufferAllocator(const AlignedBufferAllocator<U, Alignment>& rhs) noexcept {}
+
+        /** Compares two allocators, always ``true``. */
+        constexpr bool operator==(const AlignedBufferAllocator& rhs) const noexcept = default;
+
+        /**
+         * Allocates uninitialized memory.
+         *
+         * @param n Number of elements to allocate.
+         * @return Pointer to the allocated memory.
+         * @exception InsufficientMemoryException
+         */
+        T* allocate(size_t n)
+        {
+            std::byte* pRaw = reinterpret_cast<std::byte*>(malloc(AlignedBufferAllocator::RawByteCount(n)));
+            if (pRaw == nullptr)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InsufficientMemoryException, HEPH_FUNC, std::format("Failed to allocate {} bytes.", n * sizeof(T)));
+            }
+            return AlignedBufferAllocator::AlignRaw(pRaw);
+        }
+
+        /**
+         * Resizes the memory, moves the data if the allocation cannot be extended in place.
+         * The returned memory has the same alignment as the memory returned by ``allocate``.
+         *
+         * @param ptr Pointer to the memory allocated by this allocator, or ``nullptr``.
+         * @param oldN Number of elements ``ptr`` was allocated with.
+         * @param newN New number of elements.
+         * @return Pointer to the reallocated memory.
+         * @exception InsufficientMemoryException
+         */
+        T* reallocate(T* ptr, size_t oldN, size_t newN)
+        {
+            if (ptr == nullptr) return this->allocate(newN);
+
+            const size_t oldOffset = AlignedBufferAllocator::Offset(ptr);
+            std::byte* pRaw = reinterpret_cast<std::byte*>(realloc(reinterpret_cast<std::byte*>(ptr) - oldOffset, AlignedBufferAllocator::RawByteCount(newN)));
+            if (pRaw == nullptr)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InsufficientMemoryException, HEPH_FUNC, std::format("Failed to reallocate {} bytes.", newN * sizeof(T)));
+            }
+
+            T* pResult = AlignedBufferAllocator::AlignAddress(pRaw);
+            const size_t newOffset = reinterpret_cast<std::byte*>(pResult) - pRaw;
+
+            // realloc preserves the bytes but not the alignment padding,
+            // shift the data if the padding of the new block is different.
+            if (newOffset != oldOffset)
+            {
+                (void)std::memmove(pResult, pRaw + oldOffset, std::min(oldN, newN) * sizeof(T));
+            }
+            AlignedBufferAllocator::StoreOffset(pResult, newOffset);
+
+            return pResult;
+        }
+
+        /**
+         * Releases the memory.
+         *
+         * @param ptr Pointer to the memory allocated by this allocator.
+         * @param n Number of elements ``ptr`` was allocated with.
+         */
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            if (ptr != nullptr)
+                free(reinterpret_cast<std::byte*>(ptr) - AlignedBufferAllocator::Offset(ptr));
+        }
+
+    private:
+        /** Gets the number of bytes to request from the heap, including the alignment padding and the offset header. */
+        static constexpr size_t RawByteCount(size_t n)
+        {
+            return (n * sizeof(T)) + alignment + sizeof(size_t);
+        }
+
+        /** Gets the first aligned address within the raw block that leaves room for the offset header. */
+        static T* AlignAddress(std::byte* pRaw)
+        {
+            const uintptr_t address = reinterpret_cast<uintptr_t>(pRaw + sizeof(size_t));
+            return reinterpret_cast<T*>((address + (alignment - 1)) & ~(static_cast<uintptr_t>(alignment) - 1));
+        }
+
+        /** Gets the aligned address within the raw block and stores its offset right before it. */
+        static T* AlignRaw(std::byte* pRaw)
+        {
+            T* pAligned = AlignedBufferAllocator::AlignAddress(pRaw);
+            AlignedBufferAllocator::StoreOffset(pAligned, reinterpret_cast<std::byte*>(pAligned) - pRaw);
+            return pAligned;
+        }
+
+        /** Stores the distance between the aligned pointer and the start of its raw block right before the aligned pointer. */
+        static void StoreOffset(T* ptr, size_t offset)
+        {
+            (void)std::memcpy(reinterpret_cast<std::byte*>(ptr) - sizeof(size_t), &offset, sizeof(size_t));
+        }
+
+        /** Gets the distance between the aligned pointer and the start of its raw block. */
+        static size_t Offset(const T* ptr)
+        {
+            size_t offset;
+            (void)std::memcpy(&offset, reinterpret_cast<const std::byte*>(ptr) - sizeof(size_t), sizeof(size_t));
+            return offset;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef HEPH_BUFFER_ALLOCATOR_H
+#define HEPH_BUFFER_ALLOCATOR_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/Allocators/AlignedBufferAllocator.h"
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Default allocator for Heph::Buffer.
+     * Allocates from the global heap, aligned to ``HEPH_BUFFER_ALIGNMENT`` bytes.
+     *
+     * @tparam T Type of the elements to allocate.
+     */
+    template<typename T>
+    using BufferAllocator = AlignedBufferAllocator<T, HEPH_BUFFER_ALIGNMENT>;
+}
+
+#endif
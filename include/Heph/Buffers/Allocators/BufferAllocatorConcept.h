@@ -0,0 +1,44 @@
+#ifndef HEPH_BUFFER_ALLOCATOR_CONCEPT_H
+#define HEPH_BUFFER_ALLOCATOR_CONCEPT_H
+
+#include "Heph/Buffers/Iterators/BufferIteratorConcept.h"
+#include <concepts>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Specifies that the type ``T`` satisfies all requirements to be used as a buffer allocator.
+     *
+     * @note Any allocator that satisfies the standard allocator requirements,
+     * such as ``std::allocator`` or ``std::pmr::polymorphic_allocator``, can be used.
+     */
+    template<typename T, typename TData>
+    concept BufferAllocatorConcept =
+        BufferElement<TData> &&
+        std::same_as<typename T::value_type, TData> &&
+        std::copy_constructible<T> &&
+        std::equality_comparable<T> &&
+
+        requires(T allocator, TData* ptr, size_t n)
+    {
+        { allocator.allocate(n) } -> std::same_as<TData*>;
+        { allocator.deallocate(ptr, n) };
+    };
+
+    /**
+     * @brief Specifies that the buffer allocator ``T`` can resize an existing allocation,
+     * possibly without moving the data.
+     */
+    template<typename T, typename TData>
+    concept ReallocatableBufferAllocator =
+        BufferAllocatorConcept<T, TData> &&
+
+        requires(T allocator, TData* ptr, size_t n)
+    {
+        { allocator.reallocate(ptr, n, n) } -> std::same_as<TData*>;
+    };
+}
+
+#endif
@@ -3,32 +3,60 @@
 
 #include "Heph/Utils.h"
 #include "Heph//Buffers/Buffer.h"
+#include "Heph/Buffers/BufferExpression.h"
+#include "Heph/Buffers/BufferStatistics.h"
+#include "Heph/Buffers/Kernels/ArithmeticKernels.h"
+#include "Heph/Buffers/Kernels/ReductionKernels.h"
+#include "Heph/ExecutionPolicy.h"
 #include "Heph/Concepts.h"
+#include "Heph/Parallel.h"
 #include <complex>
 #include <cmath>
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 /** @file */
 
 namespace Heph
 {
+    /**
+     * @brief Specifies that applying ``TOperation`` element-wise to the operands gives elements of type ``TData``,
+     * hence the result can be stored in the memory of an operand.
+     *
+     * @tparam TOperation Type of the operation.
+     * @tparam TData Type of the elements of the result.
+     * @tparam TLhs Type of the left operand.
+     * @tparam TRhs Type of the right operand.
+     */
+    template<typename TOperation, typename TData, typename TLhs, typename TRhs>
+    concept ReusableBufferOperation = BufferExpressionOperation<TOperation, TLhs, TRhs> &&
+        std::same_as<std::remove_cvref_t<std::invoke_result_t<TOperation,
+        const typename BufferExpressionOperands<TLhs, TRhs>::lhs_type::value_type&,
+        const typename BufferExpressionOperands<TLhs, TRhs>::rhs_type::value_type&>>, TData>;
+
     /**
      * @brief Base class for buffers that store arithmetic types. Provides arithmetic operations.
      *
      * @tparam TData Type of the elements stored in buffer.
      * @tparam NDimensions Number of dimensions.
      * @tparam TIterator Type of the iterator.
+     * @tparam TAllocator Type of the allocator.
      */
     template <
         BufferElement TData,
         size_t NDimensions = 1,
-        template<typename, size_t> typename TIterator = BufferIterator
+        template<typename, size_t> typename TIterator = BufferIterator,
+        template<typename> typename TAllocator = BufferAllocator
     >
         requires Arithmetic<TData, TData>&& ArithmeticAssignable<TData, TData>
-    class HEPH_API ArithmeticBuffer : public Buffer<TData, NDimensions, TIterator>
+    class HEPH_API ArithmeticBuffer : public Buffer<TData, NDimensions, TIterator, TAllocator>
     {
     public:
         /** @brief Base class. */
-        using Buffer = Buffer<TData, NDimensions, TIterator>;
+        using Buffer = Buffer<TData, NDimensions, TIterator, TAllocator>;
 
         /** @copybrief Buffer::iterator */
         using typename Buffer::iterator;
@@ -42,6 +70,12 @@ namespace Heph
         using typename Buffer::buffer_size_t;
         /** @copybrief Buffer::buffer_index_t */
         using typename Buffer::buffer_index_t;
+        /** @copybrief Buffer::allocator_type */
+        using typename Buffer::allocator_type;
+        /** @copybrief Buffer::view_type */
+        using typename Buffer::view_type;
+        /** @copybrief Buffer::const_view_type */
+        using typename Buffer::const_view_type;
         /** @copybrief Buffer::InitializerList */
         using typename Buffer::InitializerList;
 
@@ -55,14 +89,449 @@ namespace Heph
         static constexpr TData MIN_ELEMENT = std::numeric_limits<TData>::lowest();
         /** @brief Element with the maximum value. */
         static constexpr TData MAX_ELEMENT = std::numeric_limits<TData>::max();
+        /** @brief Minimum number of elements each thread reduces, smaller reductions are done on the calling thread. */
+        static constexpr size_t PARALLEL_REDUCTION_GRAIN_SIZE = 1uz << 18;
+        /** @brief Minimum number of elements each thread processes in the element-wise kernels, smaller operations are done on the calling thread. */
+        static constexpr size_t PARALLEL_KERNEL_GRAIN_SIZE = 1uz << 17;
+
+        /**
+         * Splits contiguous elements into chunks, reduces the chunks in parallel and combines the results in the order of the chunks.
+         *
+         * @param policy Specifies whether the chunks can be reduced by multiple threads.
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         * @param kernel Function that reduces ``count`` elements starting from the pointer.
+         * @param combine Function that combines the results of two chunks.
+         */
+        template<ExecutionPolicy TPolicy, typename TKernel, typename TCombine>
+        static auto ParallelReduce(const TPolicy& policy, const TData* pData, size_t count, TKernel kernel, TCombine combine)
+        {
+            using result_t = decltype(kernel(pData, count));
+
+            if constexpr (!TPolicy::IS_PARALLEL) return kernel(pData, count);
+            else
+            {
+                if (count <= ArithmeticBuffer::PARALLEL_REDUCTION_GRAIN_SIZE) return kernel(pData, count);
+
+                std::vector<std::pair<size_t, result_t>> partialResults;
+                std::mutex mutex;
+                Parallel::For(policy, 0, count, ArithmeticBuffer::PARALLEL_REDUCTION_GRAIN_SIZE, [&](size_t begin, size_t end)
+                    {
+                        const result_t partialResult = kernel(pData + begin, end - begin);
+                        std::lock_guard<std::mutex> lock(mutex);
+                        partialResults.emplace_back(begin, partialResult);
+                    });
+
+                std::sort(partialResults.begin(), partialResults.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+                result_t result = partialResults[0].second;
+                for (size_t i = 1; i < partialResults.size(); ++i)
+                    result = combine(result, partialResults[i].second);
+                return result;
+            }
+        }
+
+        /**
+         * Reduces the elements along an axis.
+         * The elements are walked in memory order: if the axis is the innermost one, each run along the axis is reduced with ``reduceRun``,
+         * otherwise the rows after the axis are combined element-wise into the result with ``combineRow``.
+         *
+         * @note Views that are not contiguous are copied to contiguous memory first.
+         *
+         * @param policy Specifies whether the outer dimensions can be split across threads.
+         * @param view Elements to reduce.
+         * @param axis 0-based dimension to reduce.
+         * @param initialValue Value the result elements start with before ``combineRow`` is applied.
+         * @param reduceRun Function that reduces ``count`` contiguous elements, ``TResult reduceRun(const TData* pData, size_t count)``.
+         * @param combineRow Function that combines a row into the result, ``void combineRow(TResult* pResult, const TData* pRow, size_t count)``.
+         * @param allocator Allocator of the result and of the contiguous copy.
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy, typename TResult, typename TReduceRun, typename TCombineRow>
+        static ArithmeticBuffer<TResult, NDimensions - 1, TIterator, TAllocator> ReduceAxis(const TPolicy& policy, const const_view_type& view, size_t axis, const TResult& initialValue,
+            TReduceRun reduceRun, TCombineRow combineRow, const allocator_type& allocator)
+            requires (NDimensions > 1)
+        {
+            using result_buffer_t = ArithmeticBuffer<TResult, NDimensions - 1, TIterator, TAllocator>;
+
+            if (axis >= NDimensions)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Invalid axis.");
+            }
+
+            const buffer_size_t& size = view.Size();
+            typename result_buffer_t::buffer_size_t resultSize{};
+            size_t outerCount = 1;
+            size_t innerCount = 1;
+            for (size_t i = 0, j = 0; i < NDimensions; ++i)
+            {
+                if (i == axis) continue;
+
+                if constexpr (NDimensions == 2) resultSize = size[i];
+                else resultSize[j++] = size[i];
+
+                if (i < axis) outerCount *= size[i];
+                else innerCount *= size[i];
+            }
+
+            result_buffer_t result(resultSize, typename result_buffer_t::allocator_type(allocator));
+            if (outerCount == 0 || innerCount == 0) return result;
+
+            ArithmeticBuffer contiguousCopy(allocator);
+            const TData* pData = view.Data();
+            if (!view.IsContiguous())
+            {
+                contiguousCopy = ArithmeticBuffer(view, allocator);
+                pData = contiguousCopy.View().Data();
+            }
+
+            const size_t axisCount = size[axis];
+            TResult* pResult = result.View().Data();
+            const size_t grainSize = std::max(ArithmeticBuffer::PARALLEL_REDUCTION_GRAIN_SIZE / std::max(axisCount * innerCount, 1uz), 1uz);
+
+            Parallel::For(policy, 0, outerCount, grainSize, [&](size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const TData* pOuter = pData + i * axisCount * innerCount;
+                        TResult* pOuterResult = pResult + i * innerCount;
+
+                        if (innerCount == 1)
+                        {
+                            *pOuterResult = reduceRun(pOuter, axisCount);
+                        }
+                        else
+                        {
+                            std::fill(pOuterResult, pOuterResult + innerCount, initialValue);
+                            for (size_t j = 0; j < axisCount; ++j)
+                                combineRow(pOuterResult, pOuter + j * innerCount, innerCount);
+                        }
+                    }
+                });
+
+            return result;
+        }
+
+        /**
+         * Broadcasts an operand with fewer dimensions to the size of the buffer.
+         *
+         * @param rhs The operand.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires (NRhsDimensions < NDimensions)
+        BufferView<TRhsData, NDimensions> BroadcastOperand(const BufferView<TRhsData, NRhsDimensions>& rhs) const
+        {
+            if (!BufferView<TRhsData, NRhsDimensions>::template IsBroadcastable<NDimensions>(rhs.Size(), this->Size()))
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Size of the operand cannot be broadcast to the size of the buffer.");
+            }
+            return rhs.template BroadcastTo<NDimensions>(this->Size());
+        }
+
+        /** Converts a size or strides to an array, which is a scalar for single dimensional buffers. */
+        static std::array<size_t, NDimensions> ToArray(const buffer_size_t& values)
+        {
+            if constexpr (NDimensions == 1) return { values };
+            else return values;
+        }
+
+        /**
+         * Splits contiguous elements into chunks and processes the chunks in parallel.
+         *
+         * @param policy Specifies whether the chunks can be processed by multiple threads.
+         * @param count Number of elements.
+         * @param kernel Function that processes the elements in [begin, end), ``void kernel(size_t begin, size_t end)``.
+         */
+        template<ExecutionPolicy TPolicy, typename TKernel>
+        static void ParallelKernel(const TPolicy& policy, size_t count, TKernel kernel)
+        {
+            if (count <= ArithmeticBuffer::PARALLEL_KERNEL_GRAIN_SIZE) kernel(0, count);
+            else Parallel::For(policy, 0, count, ArithmeticBuffer::PARALLEL_KERNEL_GRAIN_SIZE, kernel);
+        }
+
+        /**
+         * Checks whether two ranges of ``count`` elements share some but not all of their memory.
+         * Chunks of such ranges depend on each other and must be processed in order.
+         */
+        static bool IsPartialOverlap(const TData* pDest, const TData* pSource, size_t count) noexcept
+        {
+            return pDest != pSource && pSource < pDest + count && pDest < pSource + count;
+        }
+
+        /**
+         * Applies an element-wise kernel with the operand broadcast to the size of the buffer.
+         * The elements are split into the largest innermost blocks the operand is either dense or constant in,
+         * and the kernel is called once per block, so broadcast operands are neither expanded nor read through iterators.
+         *
+         * @note Large buffers are processed in parallel if the policy allows it.
+         * An operand that shares memory with the buffer in a different layout is copied first, since its elements would be overwritten before they are read.
+         *
+         * @param policy Specifies whether the blocks can be processed by multiple threads.
+         * @param rhs Right operand.
+         * @param arrayKernel Function that is called for the blocks the operand is dense in, ``void arrayKernel(TData* pLhs, const TData* pRhs, size_t count)``.
+         * @param scalarKernel Function that is called for the blocks the operand is constant in, ``void scalarKernel(TData* pLhs, const TData& rhs, size_t count)``.
+         * @return false if the buffer is not contiguous, the operand cannot be broadcast, or it has no such blocks (e.g. a strided view).
+         */
+        template<ExecutionPolicy TPolicy, typename TArrayKernel, typename TScalarKernel>
+        bool ApplyBroadcastKernel(const TPolicy& policy, const const_view_type& rhs, TArrayKernel arrayKernel, TScalarKernel scalarKernel)
+        {
+            if (!this->IsContiguous() || !const_view_type::IsBroadcastable(rhs.Size(), this->Size())) return false;
+
+            const const_view_type operand = rhs.BroadcastTo(this->Size());
+            const TData* const pRhs = operand.Data();
+            const std::array<size_t, NDimensions> size = ArithmeticBuffer::ToArray(this->Size());
+            const std::array<size_t, NDimensions> strides = ArithmeticBuffer::ToArray(operand.Strides());
+
+            const size_t elementCount = this->ElementCount();
+            if (elementCount == 0) return true;
+
+            // the innermost dimension that has more than one element decides whether the blocks are dense or constant
+            size_t innermostDim = NDimensions - 1;
+            while (innermostDim > 0 && size[innermostDim] == 1) --innermostDim;
+            const bool isConstantBlock = size[innermostDim] > 1 && strides[innermostDim] == 0;
+
+            size_t blockDim = NDimensions;
+            size_t blockSize = 1;
+            while (blockDim > 0 && (size[blockDim - 1] == 1 || strides[blockDim - 1] == (isConstantBlock ? 0 : blockSize)))
+            {
+                --blockDim;
+                blockSize *= size[blockDim];
+            }
+            if (blockSize == 1 && blockDim > 0) return false;
+
+            // an operand that shares memory with the buffer in another layout would be read after it is overwritten
+            const bool isSameLayout = pRhs == this->pData && blockDim == 0 && !isConstantBlock;
+            if (!isSameLayout && operand.Overlaps(this->View()))
+            {
+                const ArithmeticBuffer operandCopy(rhs, this->allocator);
+                return this->ApplyBroadcastKernel(policy, operandCopy.View(), arrayKernel, scalarKernel);
+            }
+
+            if (blockDim == 0)
+            {
+                const TData rhsValue = *pRhs;
+                const auto applyRange = [&](size_t begin, size_t end)
+                    {
+                        if (isConstantBlock) scalarKernel(this->pData + begin, rhsValue, end - begin);
+                        else arrayKernel(this->pData + begin, pRhs + begin, end - begin);
+                    };
+
+                ArithmeticBuffer::ParallelKernel(policy, elementCount, applyRange);
+                return true;
+            }
+
+            const auto applyBlocks = [&](size_t blockBegin, size_t blockEnd)
+                {
+                    std::array<size_t, NDimensions> index{};
+                    size_t rhsOffset = 0;
+                    for (size_t dim = blockDim, block = blockBegin; dim-- > 0;)
+                    {
+                        index[dim] = block % size[dim];
+                        block /= size[dim];
+                        rhsOffset += index[dim] * strides[dim];
+                    }
+
+                    for (size_t block = blockBegin; block < blockEnd; ++block)
+                    {
+                        TData* const pBlock = this->pData + block * blockSize;
+                        if (isConstantBlock) scalarKernel(pBlock, pRhs[rhsOffset], blockSize);
+                        else arrayKernel(pBlock, pRhs + rhsOffset, blockSize);
+
+                        for (size_t dim = blockDim; dim-- > 0;)
+                        {
+                            rhsOffset += strides[dim];
+                            if (++index[dim] < size[dim]) break;
+                            rhsOffset -= strides[dim] * size[dim];
+                            index[dim] = 0;
+                        }
+                    }
+                };
+
+            const size_t blockCount = elementCount / blockSize;
+            if (elementCount > ArithmeticBuffer::PARALLEL_KERNEL_GRAIN_SIZE)
+                Parallel::For(policy, 0, blockCount, std::max(ArithmeticBuffer::PARALLEL_KERNEL_GRAIN_SIZE / blockSize, 1uz), applyBlocks);
+            else
+                applyBlocks(0, blockCount);
+            return true;
+        }
+
+        /** @brief Whether the operation is one of the arithmetic operators the kernels implement. */
+        template<typename TOperation>
+        static constexpr bool IS_KERNEL_OPERATION =
+            std::same_as<TOperation, std::plus<>> || std::same_as<TOperation, std::minus<>> ||
+            std::same_as<TOperation, std::multiplies<>> || std::same_as<TOperation, std::divides<>>;
+
+        /**
+         * Applies the kernel of the operation and stores the results to the destination.
+         *
+         * @param policy Specifies whether the elements can be processed by multiple threads.
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param rhs Pointer to the first element of the right operand, or a constant.
+         * @param count Number of elements.
+         */
+        template<typename TOperation, ExecutionPolicy TPolicy, typename TRhs>
+        static void ApplyKernel(const TPolicy& policy, TData* pDest, const TData* pLhs, const TRhs& rhs, size_t count)
+        {
+            const auto applyRange = [pDest, pLhs, &rhs](size_t begin, size_t end)
+                {
+                    TData* const pChunkDest = pDest + begin;
+                    const TData* const pChunkLhs = pLhs + begin;
+                    const size_t chunkCount = end - begin;
+                    TRhs chunkRhs = rhs;
+                    if constexpr (std::is_pointer_v<TRhs>) chunkRhs += begin;
+
+                    if constexpr (std::same_as<TOperation, std::plus<>>) ArithmeticKernels::Add(pChunkDest, pChunkLhs, chunkRhs, chunkCount);
+                    else if constexpr (std::same_as<TOperation, std::minus<>>) ArithmeticKernels::Subtract(pChunkDest, pChunkLhs, chunkRhs, chunkCount);
+                    else if constexpr (std::same_as<TOperation, std::multiplies<>>) ArithmeticKernels::Multiply(pChunkDest, pChunkLhs, chunkRhs, chunkCount);
+                    else ArithmeticKernels::Divide(pChunkDest, pChunkLhs, chunkRhs, chunkCount);
+                };
+
+            bool isSplittable = !ArithmeticBuffer::IsPartialOverlap(pDest, pLhs, count);
+            if constexpr (std::is_pointer_v<TRhs>) isSplittable = isSplittable && !ArithmeticBuffer::IsPartialOverlap(pDest, rhs, count);
+
+            if (isSplittable) ArithmeticBuffer::ParallelKernel(policy, count, applyRange);
+            else applyRange(0, count);
+        }
+
+        /**
+         * Evaluates ``view op view`` and ``view op constant`` expressions with the out-of-place kernels,
+         * which store the results to the destination in a single pass without copying an operand first.
+         *
+         * @param policy Specifies whether the elements can be processed by multiple threads.
+         * @param expression The expression.
+         * @param pDest Pointer to the contiguous memory the results are stored to, can be uninitialized.
+         * @return false if the expression has another form or its operands are not contiguous, nothing is stored in that case.
+         */
+        template<ExecutionPolicy TPolicy, typename TExpression>
+        static bool EvaluateWithKernel(const TPolicy&, const TExpression&, TData*)
+        {
+            return false;
+        }
+
+        /** @copydoc EvaluateWithKernel */
+        template<ExecutionPolicy TPolicy, typename TOperation>
+        static bool EvaluateWithKernel(const TPolicy& policy, const BufferBinaryExpression<BufferViewExpression<TData, NDimensions>, BufferViewExpression<TData, NDimensions>, TOperation>& expression, TData* pDest)
+        {
+            if constexpr (ArithmeticKernelElement<TData> && IS_KERNEL_OPERATION<TOperation>)
+            {
+                const const_view_type& lhs = expression.Lhs().View();
+                const const_view_type& rhs = expression.Rhs().View();
+                if (lhs.IsContiguous() && rhs.IsContiguous())
+                {
+                    ArithmeticBuffer::ApplyKernel<TOperation>(policy, pDest, lhs.Data(), rhs.Data(), lhs.ElementCount());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** @copydoc EvaluateWithKernel */
+        template<ExecutionPolicy TPolicy, typename TOperation, typename TScalar>
+        static bool EvaluateWithKernel(const TPolicy& policy, const BufferBinaryExpression<BufferViewExpression<TData, NDimensions>, BufferScalarExpression<TScalar, NDimensions>, TOperation>& expression, TData* pDest)
+        {
+            if constexpr (ArithmeticKernelScalar<TData, TScalar> && IS_KERNEL_OPERATION<TOperation>)
+            {
+                const const_view_type& lhs = expression.Lhs().View();
+                if (lhs.IsContiguous())
+                {
+                    ArithmeticBuffer::ApplyKernel<TOperation>(policy, pDest, lhs.Data(), static_cast<TData>(expression.Rhs().Value()), lhs.ElementCount());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** @copydoc EvaluateWithKernel */
+        template<ExecutionPolicy TPolicy, typename TOperation, typename TScalar>
+        static bool EvaluateWithKernel(const TPolicy& policy, const BufferBinaryExpression<BufferScalarExpression<TScalar, NDimensions>, BufferViewExpression<TData, NDimensions>, TOperation>& expression, TData* pDest)
+        {
+            // the kernels take the constant as the right operand, which only gives the same results for commutative operations
+            if constexpr (ArithmeticKernelScalar<TData, TScalar> && (std::same_as<TOperation, std::plus<>> || std::same_as<TOperation, std::multiplies<>>))
+            {
+                const const_view_type& rhs = expression.Rhs().View();
+                if (rhs.IsContiguous())
+                {
+                    ArithmeticBuffer::ApplyKernel<TOperation>(policy, pDest, rhs.Data(), static_cast<TData>(expression.Lhs().Value()), rhs.ElementCount());
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Stores the result of an operation in the memory of an operand that is about to be destroyed.
+         *
+         * @param operand The operand whose memory is reused.
+         * @param expression Expression of the operation, evaluated to a new buffer instead if its result is larger than the operand.
+         * @param apply Function that applies the operation to the operand in place, ``void apply(ArithmeticBuffer& operand)``.
+         * @return The operand that holds the result.
+         */
+        template<typename TExpression, typename TApply>
+        static ArithmeticBuffer ReuseOperand(ArithmeticBuffer&& operand, const BufferExpression<TExpression>& expression, TApply apply)
+        {
+            if (operand.Size() != expression.Derived().Size()) return ArithmeticBuffer(expression, operand.allocator);
+
+            apply(operand);
+            return std::move(operand);
+        }
 
     public:
         /** @copydoc Buffer::Buffer */
-        explicit ArithmeticBuffer(auto... size) : Buffer(std::forward<decltype(size)>(size)...) {}
-        /** @copydoc Buffer::Buffer */
-        explicit ArithmeticBuffer(const buffer_size_t& size) : Buffer(size) {}
-        /** @copydoc Buffer::Buffer(const InitializerList&) */
-        ArithmeticBuffer(const InitializerList& rhs) : Buffer(rhs) {}
+        explicit ArithmeticBuffer(auto... size) requires (std::is_convertible_v<decltype(size), size_t> && ...) : Buffer(std::forward<decltype(size)>(size)...) {}
+        /** @copydoc Buffer::Buffer(const allocator_type&) */
+        explicit ArithmeticBuffer(const allocator_type& allocator) : Buffer(allocator) {}
+        /** @copydoc Buffer::Buffer(const buffer_size_t&, const allocator_type&) */
+        explicit ArithmeticBuffer(const buffer_size_t& size, const allocator_type& allocator = allocator_type()) : Buffer(size, allocator) {}
+        /** @copydoc Buffer::Buffer(const InitializerList&, const allocator_type&) */
+        ArithmeticBuffer(const InitializerList& rhs, const allocator_type& allocator = allocator_type()) : Buffer(rhs, allocator) {}
+        /** @copydoc Buffer::Buffer(const const_view_type&, const allocator_type&) */
+        explicit ArithmeticBuffer(const const_view_type& rhs, const allocator_type& allocator = allocator_type()) : Buffer(rhs, allocator) {}
+        /**
+         * Creates a new instance and evaluates the expression to it in a single pass.
+         *
+         * @tparam TExpression Type of the expression.
+         * @param rhs Expression whose results will be stored.
+         * @param allocator @copybrief Buffer::allocator
+         * @exception InsufficientMemoryException
+         */
+        template<BufferExpressionType TExpression>
+            requires std::convertible_to<typename TExpression::value_type, TData>
+        ArithmeticBuffer(const BufferExpression<TExpression>& rhs, const allocator_type& allocator = allocator_type())
+            : ArithmeticBuffer(Execution::par, rhs, allocator) {}
+
+        /**
+         * Creates a new instance and evaluates the expression to it in a single pass.
+         *
+         * @note Allows evaluating the results of the arithmetic operators, such as ``a + b``, with a policy other than the default Execution::par.
+         *
+         * @tparam TPolicy Type of the execution policy.
+         * @tparam TExpression Type of the expression.
+         * @param policy Specifies whether the elements can be processed by multiple threads.
+         * @param rhs Expression whose results will be stored.
+         * @param allocator @copybrief Buffer::allocator
+         * @exception InsufficientMemoryException
+         */
+        template<ExecutionPolicy TPolicy, BufferExpressionType TExpression>
+            requires std::convertible_to<typename TExpression::value_type, TData>
+        ArithmeticBuffer(const TPolicy& policy, const BufferExpression<TExpression>& rhs, const allocator_type& allocator = allocator_type())
+            : Buffer(allocator)
+        {
+            const size_t elementCount = Buffer::ElementCount(rhs.Derived().Size());
+
+            this->size = rhs.Derived().Size();
+            this->CalcStrides();
+
+            if (elementCount > 0)
+            {
+                this->pData = this->Allocate(elementCount, Buffer::ALLOC_UNINITIALIZED);
+                this->capacity = elementCount;
+                if (!ArithmeticBuffer::EvaluateWithKernel(policy, rhs.Derived(), this->pData))
+                    rhs.EvaluateTo(this->View(), [](TData& element, const auto& result) { element = static_cast<TData>(result); });
+            }
+        }
+
         /** @copydoc Buffer::Buffer(const Buffer&) */
         ArithmeticBuffer(const ArithmeticBuffer& rhs) = default;
         /** @copydoc Buffer::Buffer(Buffer&&) */
@@ -70,36 +539,97 @@ namespace Heph
         /** @copydoc Buffer::operator=(const Buffer&) */
         ArithmeticBuffer& operator=(const ArithmeticBuffer& rhs) = default;
         /** @copydoc Buffer::operator=(Buffer&&) */
-        ArithmeticBuffer& operator=(ArithmeticBuffer&& rhs) noexcept = default;
+        ArithmeticBuffer& operator=(ArithmeticBuffer&& rhs) = default;
+
+        /**
+         * Evaluates the expression to the buffer in a single pass.
+         *
+         * @note Existing memory is reused if the sizes match, otherwise the buffer is reallocated.
+         *
+         * @tparam TExpression Type of the expression.
+         * @param rhs Expression whose results will be stored.
+         * @return Reference to current instance.
+         * @exception InsufficientMemoryException
+         */
+        template<BufferExpressionType TExpression>
+            requires std::convertible_to<typename TExpression::value_type, TData>
+        ArithmeticBuffer& operator=(const BufferExpression<TExpression>& rhs)
+        {
+            return this->Assign(Execution::par, rhs);
+        }
+
+        /**
+         * Evaluates the expression to the buffer in a single pass.
+         *
+         * @note Existing memory is reused if the sizes match, otherwise the buffer is reallocated.
+         *
+         * @tparam TPolicy Type of the execution policy.
+         * @tparam TExpression Type of the expression.
+         * @param policy Specifies whether the elements can be processed by multiple threads.
+         * @param rhs Expression whose results will be stored.
+         * @return Reference to current instance.
+         * @exception InsufficientMemoryException
+         */
+        template<ExecutionPolicy TPolicy, BufferExpressionType TExpression>
+            requires std::convertible_to<typename TExpression::value_type, TData>
+        ArithmeticBuffer& Assign(const TPolicy& policy, const BufferExpression<TExpression>& rhs)
+        {
+            if (this->Size() != rhs.Derived().Size()) return *this = ArithmeticBuffer(policy, rhs, this->allocator);
+            if (this->IsContiguous() && ArithmeticBuffer::EvaluateWithKernel(policy, rhs.Derived(), this->pData)) return *this;
+
+            rhs.EvaluateTo(this->View(), [](TData& element, const auto& result) { element = static_cast<TData>(result); });
+            return *this;
+        }
 
         /** @copydoc destructor */
         virtual ~ArithmeticBuffer() = default;
 
 
         /** @copydoc ArithmeticBuffer::Invert */
-        ArithmeticBuffer operator-() const
+        ArithmeticBuffer operator-() const&
         {
             ArithmeticBuffer result = *this;
             result.Invert();
             return result;
         }
 
+        /** @copydoc ArithmeticBuffer::Invert */
+        ArithmeticBuffer operator-()&&
+        {
+            this->Invert();
+            return std::move(*this);
+        }
+
         /** @copydoc operator<<= */
-        ArithmeticBuffer operator<<(size_t n) const
+        ArithmeticBuffer operator<<(size_t n) const&
         {
             ArithmeticBuffer result = *this;
             result <<= n;
             return result;
         }
 
+        /** @copydoc operator<<= */
+        ArithmeticBuffer operator<<(size_t n)&&
+        {
+            *this <<= n;
+            return std::move(*this);
+        }
+
         /** @copydoc operator>>= */
-        ArithmeticBuffer operator>>(size_t n) const
+        ArithmeticBuffer operator>>(size_t n) const&
         {
             ArithmeticBuffer result = *this;
             result >>= n;
             return result;
         }
 
+        /** @copydoc operator>>= */
+        ArithmeticBuffer operator>>(size_t n)&&
+        {
+            *this >>= n;
+            return std::move(*this);
+        }
+
         /**
          * Shiftes the top-level entries to the left by provided amount.
          *
@@ -131,205 +661,161 @@ namespace Heph
         }
 
         /**
- * Creates a copy and adds constant value to its all elements.
- *
- * @tparam TRhs Type of the rhs.
- * @param rhs Constant to add.
- * @return New instance.
- */
-        template<BufferElement TRhs>
-            requires Addable<TData, TRhs>
-        ArithmeticBuffer operator+(const TRhs& rhs) const
+         * Wraps the buffer into a leaf of the lazy expressions created by the arithmetic operators.
+         *
+         * @param buffer The buffer whose elements are read when the expression is evaluated.
+         */
+        friend BufferViewExpression<TData, NDimensions> MakeBufferExpression(const ArithmeticBuffer& buffer)
         {
-            ArithmeticBuffer result = *this;
-            result += rhs;
-            return result;
+            return BufferViewExpression<TData, NDimensions>(buffer.View());
         }
 
         /**
-         * Creates a copy and subtracts constant value from all elements.
+         * Performs element-wise addition in the memory of the left operand instead of allocating the result.
          *
-         * @tparam TRhs Type of the rhs.
-         * @param rhs Constant to subtract.
-         * @return New instance.
+         * @param lhs Left operand, which is about to be destroyed.
+         * @param rhs Right operand.
+         * @return The left operand that holds the result, or a new buffer if the result is larger than it.
+         * @exception InvalidOperationException
          */
-        template<BufferElement TRhs>
-            requires Subtractable<TData, TRhs>
-        ArithmeticBuffer operator-(const TRhs& rhs) const
+        template<typename TRhs>
+            requires ReusableBufferOperation<std::plus<>, TData, ArithmeticBuffer, TRhs>
+        friend ArithmeticBuffer operator+(ArithmeticBuffer&& lhs, const TRhs& rhs)
         {
-            ArithmeticBuffer result = *this;
-            result -= rhs;
-            return result;
+            return ArithmeticBuffer::ReuseOperand(std::move(lhs), lhs + rhs, [&rhs](ArithmeticBuffer& result) { result += rhs; });
         }
 
         /**
-         * Creates a copy and multiplies all elements with a constant.
+         * Performs element-wise addition in the memory of the right operand instead of allocating the result.
          *
-         * @tparam TRhs Type of the rhs.
-         * @param rhs Multiplication factor.
-         * @return New instance.
+         * @param lhs Left operand.
+         * @param rhs Right operand, which is about to be destroyed.
+         * @return The right operand that holds the result, or a new buffer if the result is larger than it.
+         * @exception InvalidOperationException
          */
-        template<BufferElement TRhs>
-            requires Multipliable<TData, TRhs>
-        ArithmeticBuffer operator*(const TRhs& rhs) const
+        template<typename TLhs>
+            requires ReusableBufferOperation<std::plus<>, TData, TLhs, ArithmeticBuffer>
+        friend ArithmeticBuffer operator+(const TLhs& lhs, ArithmeticBuffer&& rhs)
         {
-            ArithmeticBuffer result = *this;
-            result *= rhs;
-            return result;
+            return ArithmeticBuffer::ReuseOperand(std::move(rhs), lhs + rhs, [&lhs](ArithmeticBuffer& result) { result += lhs; });
         }
 
-        /**
-         * Creates a copy and divides all elements by a constant.
-         *
-         * @tparam TRhs Type of the rhs.
-         * @param rhs Division factor.
-         * @return New instance.
-         */
-        template<BufferElement TRhs>
-            requires Divisible<TData, TRhs>
-        ArithmeticBuffer operator/(const TRhs& rhs) const
+        /** @copydoc operator+(ArithmeticBuffer&&, const TRhs&) */
+        friend ArithmeticBuffer operator+(ArithmeticBuffer&& lhs, ArithmeticBuffer&& rhs)
+            requires ReusableBufferOperation<std::plus<>, TData, ArithmeticBuffer, ArithmeticBuffer>
         {
-            ArithmeticBuffer result = *this;
-            result /= rhs;
-            return result;
+            return std::move(lhs) + rhs;
         }
 
         /**
-         * Creates a copy and performs element-wise addition.
+         * Performs element-wise subtraction in the memory of the left operand instead of allocating the result.
          *
-         * @tparam TRhs Type of the rhs elements.
+         * @param lhs Left operand, which is about to be destroyed.
          * @param rhs Right operand.
-         * @return New instance.
+         * @return The left operand that holds the result, or a new buffer if the result is larger than it.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires Addable<TData, TRhsData>
-        ArithmeticBuffer operator+(const ArithmeticBuffer<TRhsData, NDimensions>& rhs) const
+        template<typename TRhs>
+            requires ReusableBufferOperation<std::minus<>, TData, ArithmeticBuffer, TRhs>
+        friend ArithmeticBuffer operator-(ArithmeticBuffer&& lhs, const TRhs& rhs)
         {
-            ArithmeticBuffer result = *this;
-            result += rhs;
-            return result;
+            return ArithmeticBuffer::ReuseOperand(std::move(lhs), lhs - rhs, [&rhs](ArithmeticBuffer& result) { result -= rhs; });
         }
 
         /**
-         * Creates a copy and performs element-wise subtraction.
+         * Performs element-wise subtraction in the memory of the right operand instead of allocating the result.
          *
-         * @tparam TRhs Type of the rhs elements.
-         * @param rhs Right operand.
-         * @return New instance.
+         * @param lhs Left operand.
+         * @param rhs Right operand, which is about to be destroyed.
+         * @return The right operand that holds the result, or a new buffer if the result is larger than it.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires Subtractable<TData, TRhsData>
-        ArithmeticBuffer operator-(const ArithmeticBuffer<TRhsData, NDimensions>& rhs) const
+        template<typename TLhs>
+            requires ReusableBufferOperation<std::minus<>, TData, TLhs, ArithmeticBuffer>
+        friend ArithmeticBuffer operator-(const TLhs& lhs, ArithmeticBuffer&& rhs)
         {
-            ArithmeticBuffer result = *this;
-            result -= rhs;
-            return result;
+            return ArithmeticBuffer::ReuseOperand(std::move(rhs), lhs - rhs, [&lhs](ArithmeticBuffer& result) { result = lhs - result; });
         }
 
-        /**
-         * Creates a copy and performs element-wise multiplication.
-         *
-         * @tparam TRhs Type of the rhs elements.
-         * @param rhs Right operand.
-         * @return New instance.
-         * @exception InvalidOperationException
-         */
-        template<BufferElement TRhsData>
-            requires Multipliable<TData, TRhsData>
-        ArithmeticBuffer operator*(const ArithmeticBuffer<TRhsData, NDimensions>& rhs) const
+        /** @copydoc operator-(ArithmeticBuffer&&, const TRhs&) */
+        friend ArithmeticBuffer operator-(ArithmeticBuffer&& lhs, ArithmeticBuffer&& rhs)
+            requires ReusableBufferOperation<std::minus<>, TData, ArithmeticBuffer, ArithmeticBuffer>
         {
-            ArithmeticBuffer result = *this;
-            result *= rhs;
-            return result;
+            return std::move(lhs) - rhs;
         }
 
         /**
-         * Creates a copy and performs element-wise division.
+         * Performs element-wise multiplication in the memory of the left operand instead of allocating the result.
          *
-         * @tparam TRhs Type of the rhs elements.
+         * @param lhs Left operand, which is about to be destroyed.
          * @param rhs Right operand.
-         * @return New instance.
+         * @return The left operand that holds the result, or a new buffer if the result is larger than it.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires Divisible<TData, TRhsData>
-        ArithmeticBuffer operator/(const ArithmeticBuffer<TRhsData, NDimensions>& rhs) const
+        template<typename TRhs>
+            requires ReusableBufferOperation<std::multiplies<>, TData, ArithmeticBuffer, TRhs>
+        friend ArithmeticBuffer operator*(ArithmeticBuffer&& lhs, const TRhs& rhs)
         {
-            ArithmeticBuffer result = *this;
-            result /= rhs;
-            return result;
+            return ArithmeticBuffer::ReuseOperand(std::move(lhs), lhs * rhs, [&rhs](ArithmeticBuffer& result) { result *= rhs; });
         }
 
         /**
-         * Creates a copy and adds constant value to its all elements.
+         * Performs element-wise multiplication in the memory of the right operand instead of allocating the result.
          *
-         * @tparam TLhs Type of the lhs.
          * @param lhs Left operand.
-         * @param rhs Right operand.
-         * @return New instance.
+         * @param rhs Right operand, which is about to be destroyed.
+         * @return The right operand that holds the result, or a new buffer if the result is larger than it.
+         * @exception InvalidOperationException
          */
-        template<BufferElement TLhs>
-            requires Addable<TLhs, TData, TData>
-        friend ArithmeticBuffer operator+(const TLhs& lhs, const ArithmeticBuffer& rhs)
+        template<typename TLhs>
+            requires ReusableBufferOperation<std::multiplies<>, TData, TLhs, ArithmeticBuffer>
+        friend ArithmeticBuffer operator*(const TLhs& lhs, ArithmeticBuffer&& rhs)
         {
-            return rhs + lhs;
+            return ArithmeticBuffer::ReuseOperand(std::move(rhs), lhs * rhs, [&lhs](ArithmeticBuffer& result) { result *= lhs; });
         }
 
-        /**
-         * Creates a copy and subtracts constant value from all elements.
-         *
-         * @tparam TLhs Type of the lhs.
-         * @param lhs Left operand.
-         * @param rhs Right operand.
-         * @return New instance.
-         */
-        template<BufferElement TLhs>
-            requires Subtractable<TLhs, TData, TData>
-        friend ArithmeticBuffer operator-(const TLhs& lhs, const ArithmeticBuffer& rhs)
+        /** @copydoc operator*(ArithmeticBuffer&&, const TRhs&) */
+        friend ArithmeticBuffer operator*(ArithmeticBuffer&& lhs, ArithmeticBuffer&& rhs)
+            requires ReusableBufferOperation<std::multiplies<>, TData, ArithmeticBuffer, ArithmeticBuffer>
         {
-            ArithmeticBuffer result(rhs.size);
-
-            iterator itResult = result.begin();
-            for (const TData& rhsElement : rhs) *(itResult++) = lhs - rhsElement;
-
-            return result;
+            return std::move(lhs) * rhs;
         }
 
         /**
-         * Creates a copy and multiplies all elements with a constant.
+         * Performs element-wise division in the memory of the left operand instead of allocating the result.
          *
-         * @tparam TLhs Type of the lhs.
-         * @param lhs Left operand.
+         * @param lhs Left operand, which is about to be destroyed.
          * @param rhs Right operand.
-         * @return New instance.
+         * @return The left operand that holds the result, or a new buffer if the result is larger than it.
+         * @exception InvalidOperationException
          */
-        template<BufferElement TLhs>
-            requires Multipliable<TLhs, TData, TData>
-        friend ArithmeticBuffer operator*(const TLhs& lhs, const ArithmeticBuffer& rhs)
+        template<typename TRhs>
+            requires ReusableBufferOperation<std::divides<>, TData, ArithmeticBuffer, TRhs>
+        friend ArithmeticBuffer operator/(ArithmeticBuffer&& lhs, const TRhs& rhs)
         {
-            return rhs * lhs;
+            return ArithmeticBuffer::ReuseOperand(std::move(lhs), lhs / rhs, [&rhs](ArithmeticBuffer& result) { result /= rhs; });
         }
 
         /**
-         * Creates a copy and divides all elements by a constant.
+         * Performs element-wise division in the memory of the right operand instead of allocating the result.
          *
-         * @tparam TLhs Type of the lhs.
          * @param lhs Left operand.
-         * @param rhs Right operand.
-         * @return New instance.
+         * @param rhs Right operand, which is about to be destroyed.
+         * @return The right operand that holds the result, or a new buffer if the result is larger than it.
+         * @exception InvalidOperationException
          */
-        template<BufferElement TLhs>
-            requires Divisible<TLhs, TData, TData>
-        friend ArithmeticBuffer operator/(const TLhs& lhs, const ArithmeticBuffer& rhs)
+        template<typename TLhs>
+            requires ReusableBufferOperation<std::divides<>, TData, TLhs, ArithmeticBuffer>
+        friend ArithmeticBuffer operator/(const TLhs& lhs, ArithmeticBuffer&& rhs)
         {
-            ArithmeticBuffer result(rhs.size);
-
-            iterator itResult = result.begin();
-            for (const TData& rhsElement : rhs) *(itResult++) = lhs / rhsElement;
+            return ArithmeticBuffer::ReuseOperand(std::move(rhs), lhs / rhs, [&lhs](ArithmeticBuffer& result) { result = lhs / result; });
+        }
 
-            return result;
+        /** @copydoc operator/(ArithmeticBuffer&&, const TRhs&) */
+        friend ArithmeticBuffer operator/(ArithmeticBuffer&& lhs, ArithmeticBuffer&& rhs)
+            requires ReusableBufferOperation<std::divides<>, TData, ArithmeticBuffer, ArithmeticBuffer>
+        {
+            return std::move(lhs) / rhs;
         }
 
         /**
@@ -343,25 +829,73 @@ namespace Heph
             requires AddAssignable<TData, TRhs>
         ArithmeticBuffer& operator+=(const TRhs& rhs)
         {
-            for (TData& element : *this) element += rhs;
-            return *this;
+            return this->Add(Execution::par, rhs);
         }
 
         /**
-         * Subtracts constant value from all elements.
+         * Adds constant value to all elements.
          *
          * @tparam TRhs Type of the rhs.
-         * @param rhs Constant to subtract.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Constant to add.
          * @return Reference to current instance.
          */
-        template<BufferElement TRhs>
-            requires SubtractAssignable<TData, TRhs>
-        ArithmeticBuffer& operator-=(const TRhs& rhs)
+        template<ExecutionPolicy TPolicy, BufferElement TRhs>
+            requires AddAssignable<TData, TRhs>
+        ArithmeticBuffer& Add(const TPolicy& policy, const TRhs& rhs)
         {
-            for (TData& element : *this) element -= rhs;
-            return *this;
-        }
-
+            if constexpr (ArithmeticKernelScalar<TData, TRhs>)
+            {
+                if (this->IsContiguous())
+                {
+                    ArithmeticBuffer::ParallelKernel(policy, this->ElementCount(), [pData = this->pData, value = static_cast<TData>(rhs)](size_t begin, size_t end) { ArithmeticKernels::Add(pData + begin, value, end - begin); });
+                    return *this;
+                }
+            }
+
+            for (TData& element : *this) element += rhs;
+            return *this;
+        }
+
+        /**
+         * Subtracts constant value from all elements.
+         *
+         * @tparam TRhs Type of the rhs.
+         * @param rhs Constant to subtract.
+         * @return Reference to current instance.
+         */
+        template<BufferElement TRhs>
+            requires SubtractAssignable<TData, TRhs>
+        ArithmeticBuffer& operator-=(const TRhs& rhs)
+        {
+            return this->Subtract(Execution::par, rhs);
+        }
+
+        /**
+         * Subtracts constant value from all elements.
+         *
+         * @tparam TRhs Type of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Constant to subtract.
+         * @return Reference to current instance.
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhs>
+            requires SubtractAssignable<TData, TRhs>
+        ArithmeticBuffer& Subtract(const TPolicy& policy, const TRhs& rhs)
+        {
+            if constexpr (ArithmeticKernelScalar<TData, TRhs>)
+            {
+                if (this->IsContiguous())
+                {
+                    ArithmeticBuffer::ParallelKernel(policy, this->ElementCount(), [pData = this->pData, value = static_cast<TData>(rhs)](size_t begin, size_t end) { ArithmeticKernels::Subtract(pData + begin, value, end - begin); });
+                    return *this;
+                }
+            }
+
+            for (TData& element : *this) element -= rhs;
+            return *this;
+        }
+
         /**
          * Multiplies all elements with a constant.
          *
@@ -373,6 +907,38 @@ namespace Heph
             requires MultiplyAssignable<TData, TRhs>
         ArithmeticBuffer& operator*=(const TRhs& rhs)
         {
+            return this->Multiply(Execution::par, rhs);
+        }
+
+        /**
+         * Multiplies all elements with a constant.
+         *
+         * @tparam TRhs Type of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Multiplication factor.
+         * @return Reference to current instance.
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhs>
+            requires MultiplyAssignable<TData, TRhs>
+        ArithmeticBuffer& Multiply(const TPolicy& policy, const TRhs& rhs)
+        {
+            if constexpr (ArithmeticKernelScalar<TData, TRhs>)
+            {
+                if (this->IsContiguous())
+                {
+                    ArithmeticBuffer::ParallelKernel(policy, this->ElementCount(), [pData = this->pData, value = static_cast<TData>(rhs)](size_t begin, size_t end) { ArithmeticKernels::Multiply(pData + begin, value, end - begin); });
+                    return *this;
+                }
+            }
+            else if constexpr (std::same_as<TData, std::complex<double>> && std::same_as<TRhs, double>)
+            {
+                if (this->IsContiguous())
+                {
+                    ArithmeticBuffer::ParallelKernel(policy, this->ElementCount(), [pData = this->pData, rhs](size_t begin, size_t end) { ArithmeticKernels::Multiply(pData + begin, rhs, end - begin); });
+                    return *this;
+                }
+            }
+
             for (TData& element : *this) element *= rhs;
             return *this;
         }
@@ -388,107 +954,435 @@ namespace Heph
             requires DivideAssignable<TData, TRhs>
         ArithmeticBuffer& operator/=(const TRhs& rhs)
         {
+            return this->Divide(Execution::par, rhs);
+        }
+
+        /**
+         * Divides all elements by a constant.
+         *
+         * @tparam TRhs Type of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Division factor.
+         * @return Reference to current instance.
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhs>
+            requires DivideAssignable<TData, TRhs>
+        ArithmeticBuffer& Divide(const TPolicy& policy, const TRhs& rhs)
+        {
+            if constexpr (ArithmeticKernelScalar<TData, TRhs>)
+            {
+                if (this->IsContiguous())
+                {
+                    ArithmeticBuffer::ParallelKernel(policy, this->ElementCount(), [pData = this->pData, value = static_cast<TData>(rhs)](size_t begin, size_t end) { ArithmeticKernels::Divide(pData + begin, value, end - begin); });
+                    return *this;
+                }
+            }
+            else if constexpr (std::same_as<TData, std::complex<double>> && std::same_as<TRhs, double>)
+            {
+                if (this->IsContiguous())
+                {
+                    ArithmeticBuffer::ParallelKernel(policy, this->ElementCount(), [pData = this->pData, rhs](size_t begin, size_t end) { ArithmeticKernels::Divide(pData + begin, rhs, end - begin); });
+                    return *this;
+                }
+            }
+
             for (TData& element : *this) element /= rhs;
             return *this;
         }
 
         /**
-         * Performs element-wise addition.
+         * Performs element-wise addition, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires AddAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator+=(const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Add(Execution::par, rhs.View());
+        }
+
+        /**
+         * Performs element-wise addition, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires AddAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Add(const TPolicy& policy, const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Add(policy, rhs.View());
+        }
+
+        /**
+         * Performs element-wise addition, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires AddAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator+=(const BufferView<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Add(Execution::par, rhs);
+        }
+
+        /**
+         * Performs element-wise addition, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
          *
          * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
          * @param rhs Right operand.
          * @return Reference to current instance.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires AddAssignable<TData, TRhsData>
-        ArithmeticBuffer& operator+=(const ArithmeticBuffer<TRhsData, NDimensions>& rhs)
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires AddAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Add(const TPolicy& policy, const BufferView<TRhsData, NRhsDimensions>& rhs)
         {
-            if (this->Size() != rhs.Size())
+            if constexpr (NRhsDimensions < NDimensions)
             {
-                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Size of both buffers must be the same.");
+                return this->Add(policy, this->BroadcastOperand(rhs));
             }
+            else
+            {
+                if constexpr (ArithmeticKernelElement<TData> && std::same_as<std::remove_const_t<TRhsData>, TData>)
+                {
+                    if (this->ApplyBroadcastKernel(policy, rhs,
+                        [](TData* pLhs, const TData* pRhs, size_t count) { ArithmeticKernels::Add(pLhs, pRhs, count); },
+                        [](TData* pLhs, const TData& rhs, size_t count) { ArithmeticKernels::Add(pLhs, rhs, count); }))
+                    {
+                        return *this;
+                    }
+                }
 
-            iterator itLhs = this->begin();
-            const_iterator itRhs = rhs.cbegin();
-            const_iterator itRhsEnd = rhs.cend();
-            for (; itRhs != itRhsEnd; ++itLhs, ++itRhs) *itLhs += *itRhs;
+                return *this += MakeBufferExpression(rhs);
+            }
+        }
 
+        /**
+         * Evaluates the expression and performs element-wise addition in a single pass.
+         *
+         * @tparam TExpression Type of the expression.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferExpressionType TExpression>
+            requires AddAssignable<TData, typename TExpression::value_type>
+        ArithmeticBuffer& operator+=(const BufferExpression<TExpression>& rhs)
+        {
+            rhs.EvaluateTo(this->View(), [](TData& element, const auto& result) { element += result; });
             return *this;
         }
 
         /**
-         * Performs element-wise subtraction.
+         * Performs element-wise subtraction, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires SubtractAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator-=(const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Subtract(Execution::par, rhs.View());
+        }
+
+        /**
+         * Performs element-wise subtraction, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires SubtractAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Subtract(const TPolicy& policy, const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Subtract(policy, rhs.View());
+        }
+
+        /**
+         * Performs element-wise subtraction, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires SubtractAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator-=(const BufferView<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Subtract(Execution::par, rhs);
+        }
+
+        /**
+         * Performs element-wise subtraction, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
          *
          * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
          * @param rhs Right operand.
          * @return Reference to current instance.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires SubtractAssignable<TData, TRhsData>
-        ArithmeticBuffer& operator-=(const ArithmeticBuffer<TRhsData, NDimensions>& rhs)
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires SubtractAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Subtract(const TPolicy& policy, const BufferView<TRhsData, NRhsDimensions>& rhs)
         {
-            if (this->Size() != rhs.Size())
+            if constexpr (NRhsDimensions < NDimensions)
             {
-                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Size of both buffers must be the same.");
+                return this->Subtract(policy, this->BroadcastOperand(rhs));
             }
+            else
+            {
+                if constexpr (ArithmeticKernelElement<TData> && std::same_as<std::remove_const_t<TRhsData>, TData>)
+                {
+                    if (this->ApplyBroadcastKernel(policy, rhs,
+                        [](TData* pLhs, const TData* pRhs, size_t count) { ArithmeticKernels::Subtract(pLhs, pRhs, count); },
+                        [](TData* pLhs, const TData& rhs, size_t count) { ArithmeticKernels::Subtract(pLhs, rhs, count); }))
+                    {
+                        return *this;
+                    }
+                }
 
-            iterator itLhs = this->begin();
-            const_iterator itRhs = rhs.cbegin();
-            const_iterator itRhsEnd = rhs.cend();
-            for (; itRhs != itRhsEnd; ++itLhs, ++itRhs) *itLhs -= *itRhs;
+                return *this -= MakeBufferExpression(rhs);
+            }
+        }
 
+        /**
+         * Evaluates the expression and performs element-wise subtraction in a single pass.
+         *
+         * @tparam TExpression Type of the expression.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferExpressionType TExpression>
+            requires SubtractAssignable<TData, typename TExpression::value_type>
+        ArithmeticBuffer& operator-=(const BufferExpression<TExpression>& rhs)
+        {
+            rhs.EvaluateTo(this->View(), [](TData& element, const auto& result) { element -= result; });
             return *this;
         }
 
         /**
-         * Performs element-wise multiplication.
+         * Performs element-wise multiplication, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires MultiplyAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator*=(const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Multiply(Execution::par, rhs.View());
+        }
+
+        /**
+         * Performs element-wise multiplication, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires MultiplyAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Multiply(const TPolicy& policy, const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Multiply(policy, rhs.View());
+        }
+
+        /**
+         * Performs element-wise multiplication, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires MultiplyAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator*=(const BufferView<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Multiply(Execution::par, rhs);
+        }
+
+        /**
+         * Performs element-wise multiplication, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
          *
          * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
          * @param rhs Right operand.
          * @return Reference to current instance.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires MultiplyAssignable<TData, TRhsData>
-        ArithmeticBuffer& operator*=(const ArithmeticBuffer<TRhsData, NDimensions>& rhs)
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires MultiplyAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Multiply(const TPolicy& policy, const BufferView<TRhsData, NRhsDimensions>& rhs)
         {
-            if (this->Size() != rhs.Size())
+            if constexpr (NRhsDimensions < NDimensions)
             {
-                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Size of both buffers must be the same.");
+                return this->Multiply(policy, this->BroadcastOperand(rhs));
             }
+            else
+            {
+                if constexpr (ArithmeticKernelElement<TData> && std::same_as<std::remove_const_t<TRhsData>, TData>)
+                {
+                    if (this->ApplyBroadcastKernel(policy, rhs,
+                        [](TData* pLhs, const TData* pRhs, size_t count) { ArithmeticKernels::Multiply(pLhs, pRhs, count); },
+                        [](TData* pLhs, const TData& rhs, size_t count) { ArithmeticKernels::Multiply(pLhs, rhs, count); }))
+                    {
+                        return *this;
+                    }
+                }
 
-            iterator itLhs = this->begin();
-            const_iterator itRhs = rhs.cbegin();
-            const_iterator itRhsEnd = rhs.cend();
-            for (; itRhs != itRhsEnd; ++itLhs, ++itRhs) *itLhs *= *itRhs;
+                return *this *= MakeBufferExpression(rhs);
+            }
+        }
 
+        /**
+         * Evaluates the expression and performs element-wise multiplication in a single pass.
+         *
+         * @tparam TExpression Type of the expression.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferExpressionType TExpression>
+            requires MultiplyAssignable<TData, typename TExpression::value_type>
+        ArithmeticBuffer& operator*=(const BufferExpression<TExpression>& rhs)
+        {
+            rhs.EvaluateTo(this->View(), [](TData& element, const auto& result) { element *= result; });
             return *this;
         }
 
         /**
-         * Performs element-wise division.
+         * Performs element-wise division, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires DivideAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator/=(const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Divide(Execution::par, rhs.View());
+        }
+
+        /**
+         * Performs element-wise division, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires DivideAssignable<TData, TRhsData> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Divide(const TPolicy& policy, const ArithmeticBuffer<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Divide(policy, rhs.View());
+        }
+
+        /**
+         * Performs element-wise division, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
+         *
+         * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TRhsData, size_t NRhsDimensions>
+            requires DivideAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& operator/=(const BufferView<TRhsData, NRhsDimensions>& rhs)
+        {
+            return this->Divide(Execution::par, rhs);
+        }
+
+        /**
+         * Performs element-wise division, the rhs is broadcast to the size of the buffer (see BufferView::BroadcastTo).
          *
          * @tparam TRhs Type of the rhs elements.
+         * @tparam NRhsDimensions Number of dimensions of the rhs.
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
          * @param rhs Right operand.
          * @return Reference to current instance.
          * @exception InvalidOperationException
          */
-        template<BufferElement TRhsData>
-            requires DivideAssignable<TData, TRhsData>
-        ArithmeticBuffer& operator/=(const ArithmeticBuffer<TRhsData, NDimensions>& rhs)
+        template<ExecutionPolicy TPolicy, BufferElement TRhsData, size_t NRhsDimensions>
+            requires DivideAssignable<TData, std::remove_const_t<TRhsData>> && (NRhsDimensions <= NDimensions)
+        ArithmeticBuffer& Divide(const TPolicy& policy, const BufferView<TRhsData, NRhsDimensions>& rhs)
         {
-            if (this->Size() != rhs.Size())
+            if constexpr (NRhsDimensions < NDimensions)
             {
-                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Size of both buffers must be the same.");
+                return this->Divide(policy, this->BroadcastOperand(rhs));
             }
+            else
+            {
+                if constexpr (ArithmeticKernelElement<TData> && std::same_as<std::remove_const_t<TRhsData>, TData>)
+                {
+                    if (this->ApplyBroadcastKernel(policy, rhs,
+                        [](TData* pLhs, const TData* pRhs, size_t count) { ArithmeticKernels::Divide(pLhs, pRhs, count); },
+                        [](TData* pLhs, const TData& rhs, size_t count) { ArithmeticKernels::Divide(pLhs, rhs, count); }))
+                    {
+                        return *this;
+                    }
+                }
 
-            iterator itLhs = this->begin();
-            const_iterator itRhs = rhs.cbegin();
-            const_iterator itRhsEnd = rhs.cend();
-            for (; itRhs != itRhsEnd; ++itLhs, ++itRhs) *itLhs /= *itRhs;
+                return *this /= MakeBufferExpression(rhs);
+            }
+        }
 
+        /**
+         * Evaluates the expression and performs element-wise division in a single pass.
+         *
+         * @tparam TExpression Type of the expression.
+         * @param rhs Right operand.
+         * @return Reference to current instance.
+         * @exception InvalidOperationException
+         */
+        template<BufferExpressionType TExpression>
+            requires DivideAssignable<TData, typename TExpression::value_type>
+        ArithmeticBuffer& operator/=(const BufferExpression<TExpression>& rhs)
+        {
+            rhs.EvaluateTo(this->View(), [](TData& element, const auto& result) { element /= result; });
             return *this;
         }
 
@@ -504,7 +1398,7 @@ namespace Heph
          */
         virtual ArithmeticBuffer SubBuffer(size_t index, size_t size)
         {
-            ArithmeticBuffer result;
+            ArithmeticBuffer result(this->allocator);
             Buffer::SubBuffer(*this, result, index, size);
             return result;
         }
@@ -590,10 +1484,21 @@ namespace Heph
             this->Transpose(mode, permArray);
         }
 
-        /**
-         * Transposes a multidimensional buffer.
-         *
-         * @note This method allocates memory for the destination buffer, hence no need to allocate in advance.
+        /** @copydoc ArithmeticBuffer::Transpose(const TPolicy&, Enum<TransposeMode>, const buffer_size_t&) */
+        template<ExecutionPolicy TPolicy>
+        void Transpose(const TPolicy& policy, Enum<TransposeMode> mode, auto... perm)
+        {
+            static_assert(sizeof...(perm) == NDimensions, "Invalid number of perm parameters.");
+            static_assert((std::is_convertible_v<decltype(perm), size_t> && ...), "Invalid type for perm parameters, must be convertible to size_t.");
+
+            const buffer_size_t permArray = { std::forward<size_t>(static_cast<size_t>(perm))... };
+            this->Transpose(policy, mode, permArray);
+        }
+
+        /**
+         * Transposes a multidimensional buffer.
+         *
+         * @note This method allocates memory for the destination buffer, hence no need to allocate in advance.
          *
          * @param mode Specifies how the transpose operation modifies the buffer.
          * @param perm Permutation of the dimensions.
@@ -603,7 +1508,18 @@ namespace Heph
          */
         virtual void Transpose(Enum<TransposeMode> mode, const buffer_size_t& perm)
         {
-            Buffer::Transpose(*this, *this, perm, mode);
+            this->Transpose(Execution::par, mode, perm);
+        }
+
+        /**
+         * @copydoc ArithmeticBuffer::Transpose(Enum<TransposeMode>, const buffer_size_t&)
+         *
+         * @param policy Specifies whether large buffers can be reordered by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        void Transpose(const TPolicy& policy, Enum<TransposeMode> mode, const buffer_size_t& perm)
+        {
+            Buffer::Transpose(policy, *this, *this, perm, mode);
         }
 
 
@@ -627,7 +1543,29 @@ namespace Heph
         /** @copydoc Resize */
         virtual void Resize(const buffer_size_t& newSize)
         {
-            Buffer::Resize(*this, newSize);
+            this->Resize(Execution::par, newSize);
+        }
+
+        /**
+         * @copydoc Resize
+         *
+         * @param policy Specifies whether the kept elements of a multidimensional buffer can be copied by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        void Resize(const TPolicy& policy, auto... newSize)
+        {
+            static_assert(sizeof...(newSize) > 0 && sizeof...(newSize) <= NDimensions, "Invalid number of newSize parametrs");
+            static_assert((std::is_convertible_v<decltype(newSize), size_t> && ...), "Invalid type for newSize parameters, must be convertible to size_t.");
+
+            const buffer_size_t ns = { std::forward<size_t>(static_cast<size_t>(newSize))... };
+            this->Resize(policy, ns);
+        }
+
+        /** @copydoc Resize(const TPolicy&, auto...) */
+        template<ExecutionPolicy TPolicy>
+        void Resize(const TPolicy& policy, const buffer_size_t& newSize)
+        {
+            Buffer::Resize(policy, *this, newSize);
         }
 
         /**
@@ -638,7 +1576,18 @@ namespace Heph
          */
         virtual void Reverse(size_t dim = 0)
         {
-            Buffer::Reverse(*this, dim);
+            this->Reverse(Execution::par, dim);
+        }
+
+        /**
+         * @copydoc Reverse
+         *
+         * @param policy Specifies whether large buffers can be reversed by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        void Reverse(const TPolicy& policy, size_t dim = 0)
+        {
+            Buffer::Reverse(policy, *this, dim);
         }
 
         /**
@@ -660,6 +1609,41 @@ namespace Heph
 
         /** Gets the element with the minimum value. */
         TData Min() const
+        {
+            return ArithmeticBuffer::Min(this->View());
+        }
+
+        /**
+         * Gets the element with the minimum value.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        TData Min(const TPolicy& policy) const
+        {
+            return ArithmeticBuffer::Min(policy, this->View());
+        }
+
+        /**
+         * Gets the element with the minimum value.
+         *
+         * @param view Elements to search.
+         * @exception InvalidOperationException
+         */
+        static TData Min(const const_view_type& view)
+        {
+            return ArithmeticBuffer::Min(Execution::par, view);
+        }
+
+        /**
+         * Gets the element with the minimum value.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to search.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy>
+        static TData Min(const TPolicy& policy, const const_view_type& view)
         {
             if constexpr (!HasLessThan<TData>)
             {
@@ -667,8 +1651,18 @@ namespace Heph
             }
             else
             {
+                if constexpr (ReductionKernelElement<TData>)
+                {
+                    if (view.IsContiguous())
+                    {
+                        return ArithmeticBuffer::ParallelReduce(policy, view.Data(), view.ElementCount(),
+                            &ReductionKernels::Min<TData>,
+                            [](TData lhs, TData rhs) { return (rhs < lhs) ? rhs : lhs; });
+                    }
+                }
+
                 TData result = ArithmeticBuffer::MAX_ELEMENT;
-                for (const TData& element : *this)
+                for (const TData& element : view)
                     if (element < result) result = element;
                 return result;
             }
@@ -676,6 +1670,41 @@ namespace Heph
 
         /** Gets the element with the maximum value. */
         TData Max() const
+        {
+            return ArithmeticBuffer::Max(this->View());
+        }
+
+        /**
+         * Gets the element with the maximum value.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        TData Max(const TPolicy& policy) const
+        {
+            return ArithmeticBuffer::Max(policy, this->View());
+        }
+
+        /**
+         * Gets the element with the maximum value.
+         *
+         * @param view Elements to search.
+         * @exception InvalidOperationException
+         */
+        static TData Max(const const_view_type& view)
+        {
+            return ArithmeticBuffer::Max(Execution::par, view);
+        }
+
+        /**
+         * Gets the element with the maximum value.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to search.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy>
+        static TData Max(const TPolicy& policy, const const_view_type& view)
         {
             if constexpr (!HasGreaterThan<TData>)
             {
@@ -683,8 +1712,18 @@ namespace Heph
             }
             else
             {
+                if constexpr (ReductionKernelElement<TData>)
+                {
+                    if (view.IsContiguous())
+                    {
+                        return ArithmeticBuffer::ParallelReduce(policy, view.Data(), view.ElementCount(),
+                            &ReductionKernels::Max<TData>,
+                            [](TData lhs, TData rhs) { return (rhs > lhs) ? rhs : lhs; });
+                    }
+                }
+
                 TData result = ArithmeticBuffer::MIN_ELEMENT;
-                for (const TData& element : *this)
+                for (const TData& element : view)
                     if (element > result) result = element;
                 return result;
             }
@@ -692,6 +1731,41 @@ namespace Heph
 
         /** Gets the element with the maximum absolute value. */
         TData AbsMax() const
+        {
+            return ArithmeticBuffer::AbsMax(this->View());
+        }
+
+        /**
+         * Gets the element with the maximum absolute value.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        TData AbsMax(const TPolicy& policy) const
+        {
+            return ArithmeticBuffer::AbsMax(policy, this->View());
+        }
+
+        /**
+         * Gets the element with the maximum absolute value.
+         *
+         * @param view Elements to search.
+         * @exception InvalidOperationException
+         */
+        static TData AbsMax(const const_view_type& view)
+        {
+            return ArithmeticBuffer::AbsMax(Execution::par, view);
+        }
+
+        /**
+         * Gets the element with the maximum absolute value.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to search.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy>
+        static TData AbsMax(const TPolicy& policy, const const_view_type& view)
         {
             if constexpr (!HasGreaterThan<TData>)
             {
@@ -699,9 +1773,19 @@ namespace Heph
             }
             else
             {
+                if constexpr (ReductionKernelElement<TData>)
+                {
+                    if (view.IsContiguous())
+                    {
+                        return ArithmeticBuffer::ParallelReduce(policy, view.Data(), view.ElementCount(),
+                            &ReductionKernels::AbsMax<TData>,
+                            [](TData lhs, TData rhs) { return (rhs > lhs) ? rhs : lhs; });
+                    }
+                }
+
                 TData result = ArithmeticBuffer::MIN_ELEMENT;
                 TData absElement = 0;
-                for (const TData& element : *this)
+                for (const TData& element : view)
                 {
                     absElement = std::abs(element);
                     if (absElement > result) result = absElement;
@@ -712,6 +1796,41 @@ namespace Heph
 
         /** Calculates the root mean square. */
         double Rms() const
+        {
+            return ArithmeticBuffer::Rms(this->View());
+        }
+
+        /**
+         * Calculates the root mean square.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        double Rms(const TPolicy& policy) const
+        {
+            return ArithmeticBuffer::Rms(policy, this->View());
+        }
+
+        /**
+         * Calculates the root mean square.
+         *
+         * @param view Elements to calculate the rms of.
+         * @exception InvalidOperationException
+         */
+        static double Rms(const const_view_type& view)
+        {
+            return ArithmeticBuffer::Rms(Execution::par, view);
+        }
+
+        /**
+         * Calculates the root mean square.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to calculate the rms of.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy>
+        static double Rms(const TPolicy& policy, const const_view_type& view)
         {
             if constexpr (!Multipliable<TData, TData, double>)
             {
@@ -719,15 +1838,512 @@ namespace Heph
             }
             else
             {
-                const size_t elementCount = this->ElementCount();
+                const size_t elementCount = view.ElementCount();
                 if (elementCount == 0) return 0;
 
+                if constexpr (ReductionKernelElement<TData>)
+                {
+                    if (view.IsContiguous())
+                    {
+                        const double sumSquared = ArithmeticBuffer::ParallelReduce(policy, view.Data(), elementCount,
+                            &ReductionKernels::SumOfSquares<TData>,
+                            [](double lhs, double rhs) { return lhs + rhs; });
+                        return std::sqrt(sumSquared / static_cast<double>(elementCount));
+                    }
+                }
+
+                // Kahan summation, a single accumulator loses precision on long buffers
                 double sumSquared = 0;
-                for (const TData& element : *this)
-                    sumSquared += element * element;
+                double compensation = 0;
+                for (const TData& element : view)
+                {
+                    const double y = static_cast<double>(element * element) - compensation;
+                    const double t = sumSquared + y;
+                    compensation = (t - sumSquared) - y;
+                    sumSquared = t;
+                }
                 return std::sqrt(sumSquared / static_cast<double>(elementCount));
             }
         }
+
+        /**
+         * Calculates the min, max, absolute max, sum, mean, variance and rms with a single pass over the elements.
+         * Faster than calling the individual methods when more than one of them is needed.
+         */
+        BufferStatistics<TData> Statistics() const
+        {
+            return ArithmeticBuffer::Statistics(this->View());
+        }
+
+        /**
+         * Calculates the min, max, absolute max, sum, mean, variance and rms with a single pass over the elements.
+         * Faster than calling the individual methods when more than one of them is needed.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        BufferStatistics<TData> Statistics(const TPolicy& policy) const
+        {
+            return ArithmeticBuffer::Statistics(policy, this->View());
+        }
+
+        /**
+         * Calculates the min, max, absolute max, sum, mean, variance and rms with a single pass over the elements.
+         *
+         * @param view Elements to calculate the statistics of.
+         * @exception InvalidOperationException
+         */
+        static BufferStatistics<TData> Statistics(const const_view_type& view)
+        {
+            return ArithmeticBuffer::Statistics(Execution::par, view);
+        }
+
+        /**
+         * Calculates the min, max, absolute max, sum, mean, variance and rms with a single pass over the elements.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to calculate the statistics of.
+         * @exception InvalidOperationException
+         */
+        template<ExecutionPolicy TPolicy>
+        static BufferStatistics<TData> Statistics(const TPolicy& policy, const const_view_type& view)
+        {
+            if constexpr (!HasLessThan<TData> || !HasGreaterThan<TData> || !std::is_convertible_v<TData, double>)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Cannot calculate the statistics, invalid type TData.");
+            }
+            else
+            {
+                if constexpr (ReductionKernelElement<TData>)
+                {
+                    if (view.IsContiguous())
+                    {
+                        return ArithmeticBuffer::ParallelReduce(policy, view.Data(), view.ElementCount(),
+                            &ReductionKernels::Statistics<TData>,
+                            [](BufferStatistics<TData> lhs, const BufferStatistics<TData>& rhs)
+                            {
+                                lhs.Merge(rhs);
+                                return lhs;
+                            });
+                    }
+                }
+
+                BufferStatistics<TData> result;
+                for (const TData& element : view)
+                    result.Add(element);
+                return result;
+            }
+        }
+
+        /**
+         * Calculates the sum of the elements along an axis.
+         *
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Sum(size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Sum(this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Calculates the sum of the elements along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Sum(const TPolicy& policy, size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Sum(policy, this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Calculates the sum of the elements along an axis.
+         *
+         * @param view Elements to reduce.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Sum(const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Sum(Execution::par, view, axis, allocator);
+        }
+
+        /**
+         * Calculates the sum of the elements along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to reduce.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Sum(const TPolicy& policy, const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            if constexpr (!Addable<TData>)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "No suitable '+' operator defined.");
+            }
+            else
+            {
+                return ArithmeticBuffer::ReduceAxis(policy, view, axis, TData(0),
+                    [](const TData* pData, size_t count)
+                    {
+                        if constexpr (ReductionKernelElement<TData>)
+                        {
+                            return static_cast<TData>(ReductionKernels::Sum(pData, count));
+                        }
+                        else
+                        {
+                            TData result = TData(0);
+                            for (size_t i = 0; i < count; ++i) result += pData[i];
+                            return result;
+                        }
+                    },
+                    [](TData* pResult, const TData* pRow, size_t count)
+                    {
+                        if constexpr (ArithmeticKernelElement<TData>) ArithmeticKernels::Add(pResult, pRow, count);
+                        else for (size_t i = 0; i < count; ++i) pResult[i] += pRow[i];
+                    }, allocator);
+            }
+        }
+
+        /**
+         * Calculates the mean of the elements along an axis.
+         *
+         * @note For integral types the mean is truncated.
+         *
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Mean(size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Mean(this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Calculates the mean of the elements along an axis.
+         *
+         * @note For integral types the mean is truncated.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Mean(const TPolicy& policy, size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Mean(policy, this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Calculates the mean of the elements along an axis.
+         *
+         * @note For integral types the mean is truncated.
+         *
+         * @param view Elements to reduce.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed, filled with zeros if the axis is empty.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Mean(const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Mean(Execution::par, view, axis, allocator);
+        }
+
+        /**
+         * Calculates the mean of the elements along an axis.
+         *
+         * @note For integral types the mean is truncated.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to reduce.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed, filled with zeros if the axis is empty.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Mean(const TPolicy& policy, const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> result = ArithmeticBuffer::Sum(policy, view, axis, allocator);
+
+            const size_t axisCount = view.Size()[axis];
+            if (axisCount > 0) result.Divide(policy, static_cast<TData>(axisCount));
+            return result;
+        }
+
+        /**
+         * Finds the minimum elements along an axis.
+         *
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Min(size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Min(this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Finds the minimum elements along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Min(const TPolicy& policy, size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Min(policy, this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Finds the minimum elements along an axis.
+         *
+         * @param view Elements to search.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Min(const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Min(Execution::par, view, axis, allocator);
+        }
+
+        /**
+         * Finds the minimum elements along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to search.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Min(const TPolicy& policy, const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            if constexpr (!HasLessThan<TData>)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "No suitable '<' operator defined.");
+            }
+            else
+            {
+                return ArithmeticBuffer::ReduceAxis(policy, view, axis, ArithmeticBuffer::MAX_ELEMENT,
+                    [](const TData* pData, size_t count)
+                    {
+                        if constexpr (ReductionKernelElement<TData>)
+                        {
+                            return ReductionKernels::Min(pData, count);
+                        }
+                        else
+                        {
+                            TData result = ArithmeticBuffer::MAX_ELEMENT;
+                            for (size_t i = 0; i < count; ++i)
+                                if (pData[i] < result) result = pData[i];
+                            return result;
+                        }
+                    },
+                    [](TData* pResult, const TData* pRow, size_t count)
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                            pResult[i] = (pRow[i] < pResult[i]) ? pRow[i] : pResult[i];
+                    }, allocator);
+            }
+        }
+
+        /**
+         * Finds the maximum elements along an axis.
+         *
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Max(size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Max(this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Finds the maximum elements along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Max(const TPolicy& policy, size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Max(policy, this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Finds the maximum elements along an axis.
+         *
+         * @param view Elements to search.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Max(const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Max(Execution::par, view, axis, allocator);
+        }
+
+        /**
+         * Finds the maximum elements along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to search.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        static ArithmeticBuffer<TData, NDimensions - 1, TIterator, TAllocator> Max(const TPolicy& policy, const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            if constexpr (!HasGreaterThan<TData>)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "No suitable '>' operator defined.");
+            }
+            else
+            {
+                return ArithmeticBuffer::ReduceAxis(policy, view, axis, ArithmeticBuffer::MIN_ELEMENT,
+                    [](const TData* pData, size_t count)
+                    {
+                        if constexpr (ReductionKernelElement<TData>)
+                        {
+                            return ReductionKernels::Max(pData, count);
+                        }
+                        else
+                        {
+                            TData result = ArithmeticBuffer::MIN_ELEMENT;
+                            for (size_t i = 0; i < count; ++i)
+                                if (pData[i] > result) result = pData[i];
+                            return result;
+                        }
+                    },
+                    [](TData* pResult, const TData* pRow, size_t count)
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                            pResult[i] = (pRow[i] > pResult[i]) ? pRow[i] : pResult[i];
+                    }, allocator);
+            }
+        }
+
+        /**
+         * Calculates the root mean square along an axis.
+         *
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        ArithmeticBuffer<double, NDimensions - 1, TIterator, TAllocator> Rms(size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Rms(this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Calculates the root mean square along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param axis 0-based dimension to reduce.
+         * @return Buffer with the reduced dimension removed.
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        ArithmeticBuffer<double, NDimensions - 1, TIterator, TAllocator> Rms(const TPolicy& policy, size_t axis) const requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Rms(policy, this->View(), axis, this->allocator);
+        }
+
+        /**
+         * Calculates the root mean square along an axis.
+         *
+         * @param view Elements to calculate the rms of.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed, filled with zeros if the axis is empty.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        static ArithmeticBuffer<double, NDimensions - 1, TIterator, TAllocator> Rms(const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            return ArithmeticBuffer::Rms(Execution::par, view, axis, allocator);
+        }
+
+        /**
+         * Calculates the root mean square along an axis.
+         *
+         * @param policy Specifies whether large buffers can be processed by multiple threads.
+         * @param view Elements to calculate the rms of.
+         * @param axis 0-based dimension to reduce.
+         * @param allocator Allocator of the result.
+         * @return Buffer with the reduced dimension removed, filled with zeros if the axis is empty.
+         * @exception InvalidOperationException
+         * @exception InvalidArgumentException
+         */
+        template<ExecutionPolicy TPolicy>
+        static ArithmeticBuffer<double, NDimensions - 1, TIterator, TAllocator> Rms(const TPolicy& policy, const const_view_type& view, size_t axis, const allocator_type& allocator = allocator_type()) requires (NDimensions > 1)
+        {
+            if constexpr (!Multipliable<TData, TData, double>)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Cannot calculate the rms, invalid type TData.");
+            }
+            else
+            {
+                ArithmeticBuffer<double, NDimensions - 1, TIterator, TAllocator> result = ArithmeticBuffer::ReduceAxis(policy, view, axis, 0.0,
+                    [](const TData* pData, size_t count)
+                    {
+                        if constexpr (ReductionKernelElement<TData>)
+                        {
+                            return ReductionKernels::SumOfSquares(pData, count);
+                        }
+                        else
+                        {
+                            double result = 0;
+                            for (size_t i = 0; i < count; ++i) result += static_cast<double>(pData[i] * pData[i]);
+                            return result;
+                        }
+                    },
+                    [](double* pResult, const TData* pRow, size_t count)
+                    {
+                        for (size_t i = 0; i < count; ++i) pResult[i] += static_cast<double>(pRow[i] * pRow[i]);
+                    }, allocator);
+
+                const size_t axisCount = view.Size()[axis];
+                if (axisCount > 0)
+                {
+                    for (double& element : result) element = std::sqrt(element / static_cast<double>(axisCount));
+                }
+                return result;
+            }
+        }
     };
 
     using RealBuffer = ArithmeticBuffer<double, 1>;
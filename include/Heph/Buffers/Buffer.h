@@ -3,7 +3,12 @@
 
 #include "Heph/Utils.h"
 #include "Heph/Buffers/Iterators/BufferIterator.h"
+#include "Heph/Buffers/BufferView.h"
+#include "Heph/Buffers/BufferTransform.h"
+#include "Heph/Buffers/Allocators/BufferAllocator.h"
 #include "Heph/Enum.h"
+#include "Heph/ExecutionPolicy.h"
+#include "Heph/Parallel.h"
 #include "Heph/Exceptions/Exception.h"
 #include "Heph/Exceptions/InvalidArgumentException.h"
 #include "Heph/Exceptions/InvalidOperationException.h"
@@ -13,6 +18,10 @@
 #include <algorithm>
 #include <ranges>
 #include <numeric>
+#include <memory>
+#include <new>
+#include <cstring>
+#include <type_traits>
 
 /** @file */
 
@@ -49,13 +58,15 @@ namespace Heph
     * @tparam TData Type of the elements stored in buffer. Must be default constructible and trivally destructible.
     * @tparam NDimensions Number of dimensions.
     * @tparam TIterator Type of the iterator.
+    * @tparam TAllocator Type of the allocator.
     */
     template <
         BufferElement TData,
         size_t NDimensions = 1,
-        template<typename, size_t> typename TIterator = BufferIterator
+        template<typename, size_t> typename TIterator = BufferIterator,
+        template<typename> typename TAllocator = BufferAllocator
     >
-        requires (NDimensions > 0) && BufferIteratorConcept<TIterator<TData, NDimensions>, TData, NDimensions>
+        requires (NDimensions > 0) && BufferIteratorConcept<TIterator<TData, NDimensions>, TData, NDimensions> && BufferAllocatorConcept<TAllocator<TData>, TData>
     class HEPH_API Buffer
     {
     public:
@@ -71,6 +82,14 @@ namespace Heph
         using buffer_size_t = iterator::buffer_size_t;
         /** @copybrief BufferIteratorTraits::buffer_index_t */
         using buffer_index_t = iterator::buffer_index_t;
+        /** @brief Type of the allocator used by the Buffer. */
+        using allocator_type = TAllocator<TData>;
+        /** @brief Provides uniform access to the allocator properties. */
+        using allocator_traits = std::allocator_traits<allocator_type>;
+        /** @brief Type of the view over the elements. */
+        using view_type = BufferView<TData, NDimensions>;
+        /** @brief Type of the read-only view over the elements. */
+        using const_view_type = BufferView<const TData, NDimensions>;
 
         /** @brief Type of the initializer list. */
         using InitializerList = typename BufferInitializerListHelper<TData, NDimensions>::type;
@@ -79,6 +98,16 @@ namespace Heph
         static constexpr bool ALLOC_UNINITIALIZED = false;
         /** Specifies the memory will be initialized after allocation. */
         static constexpr bool ALLOC_INITIALIZED = true;
+        /** Alignment of the memory returned by the allocator, in bytes. */
+        static constexpr size_t ALLOCATION_ALIGNMENT = []()
+            {
+                if constexpr (requires { allocator_type::alignment; }) return static_cast<size_t>(allocator_type::alignment);
+                else return alignof(TData);
+            }();
+        /** Smallest number of elements whose size is a multiple of the allocation alignment, moving the first element by a multiple of it keeps it aligned. */
+        static constexpr size_t ALIGNED_ELEMENT_STEP = ALLOCATION_ALIGNMENT / std::gcd(ALLOCATION_ALIGNMENT, sizeof(TData));
+        /** Minimum number of elements each thread copies when reordering the elements, smaller copies are done on the calling thread. */
+        static constexpr size_t PARALLEL_COPY_GRAIN_SIZE = 1uz << 16;
 
     public:
         /** @copybrief BufferIteratorTraits::BUFFER_SIZE_ZERO */
@@ -93,6 +122,12 @@ namespace Heph
         buffer_size_t size;
         /** @brief Number of elements to advance in one step for each dimension. */
         buffer_size_t strides;
+        /** @brief Number of elements the allocated memory can hold, starting from the first element. */
+        size_t capacity;
+        /** @brief Number of unused elements allocated before the first element. */
+        size_t headroom;
+        /** @brief Allocator used for managing the memory. */
+        HEPH_NO_UNIQUE_ADDRESS allocator_type allocator;
 
     public:
         /**
@@ -102,10 +137,10 @@ namespace Heph
          * @exception InsufficientMemoryException
          */
         explicit Buffer(auto... size)
-            : pData(nullptr), size(BUFFER_SIZE_ZERO), strides(BUFFER_SIZE_ZERO)
+            requires (std::is_convertible_v<decltype(size), size_t> && ...)
+        : pData(nullptr), size(BUFFER_SIZE_ZERO), strides(BUFFER_SIZE_ZERO), capacity(0), headroom(0), allocator()
         {
             static_assert(sizeof...(size) <= NDimensions, "Invalid number of size parameters parameters.");
-            static_assert((std::is_convertible_v<decltype(size), size_t> && ...), "Invalid type for size parameters, must be convertible to size_t.");
 
             if constexpr (sizeof...(size) > 0)
             {
@@ -116,25 +151,38 @@ namespace Heph
             const size_t elementCount = this->ElementCount();
             if (elementCount > 0)
             {
-                this->pData = Buffer::Allocate(elementCount, ALLOC_INITIALIZED);
+                this->pData = this->Allocate(elementCount, ALLOC_INITIALIZED);
+                this->capacity = elementCount;
             }
 
             this->CalcStrides();
         }
 
+        /**
+         * @copydoc constructor
+         *
+         * @param allocator @copybrief allocator
+         */
+        explicit Buffer(const allocator_type& allocator)
+            : pData(nullptr), size(BUFFER_SIZE_ZERO), strides(BUFFER_SIZE_ZERO), capacity(0), headroom(0), allocator(allocator)
+        {
+        }
+
         /**
          * @copydoc constructor
          *
          * @param size @copybrief size
+         * @param allocator @copybrief allocator
          * @exception InsufficientMemoryException
          */
-        explicit Buffer(const buffer_size_t& size)
-            : pData(nullptr), size(size), strides(BUFFER_SIZE_ZERO)
+        explicit Buffer(const buffer_size_t& size, const allocator_type& allocator = allocator_type())
+            : pData(nullptr), size(size), strides(BUFFER_SIZE_ZERO), capacity(0), headroom(0), allocator(allocator)
         {
             const size_t elementCount = this->ElementCount();
             if (elementCount > 0)
             {
-                this->pData = Buffer::Allocate(elementCount, ALLOC_INITIALIZED);
+                this->pData = this->Allocate(elementCount, ALLOC_INITIALIZED);
+                this->capacity = elementCount;
             }
             this->CalcStrides();
         }
@@ -143,27 +191,55 @@ namespace Heph
          * @copydoc constructor
          *
          * @param rhs Initializer list.
+         * @param allocator @copybrief allocator
          * @exception InvalidArgumentException
          * @exception InsufficientMemoryException
          */
-        Buffer(const InitializerList& rhs)
-            : Buffer()
+        Buffer(const InitializerList& rhs, const allocator_type& allocator = allocator_type())
+            : Buffer(allocator)
         {
             *this = rhs;
         }
 
+        /**
+         * Creates a new instance and copies the elements of the view to it.
+         *
+         * @param rhs View whose elements will be copied.
+         * @param allocator @copybrief allocator
+         * @exception InsufficientMemoryException
+         */
+        explicit Buffer(const const_view_type& rhs, const allocator_type& allocator = allocator_type())
+            : Buffer(allocator)
+        {
+            const size_t elementCount = rhs.ElementCount();
+
+            this->size = rhs.Size();
+            this->CalcStrides();
+
+            if (elementCount > 0)
+            {
+                this->pData = this->Allocate(elementCount, ALLOC_UNINITIALIZED);
+                this->capacity = elementCount;
+                rhs.CopyTo(this->pData);
+            }
+        }
+
         /** @copydoc copy_constructor */
         Buffer(const Buffer& rhs)
-            : Buffer()
+            : Buffer(allocator_traits::select_on_container_copy_construction(rhs.allocator))
         {
             *this = rhs;
         }
 
         /** @copydoc move_constructor */
         Buffer(Buffer&& rhs) noexcept
-            : Buffer()
+            : pData(rhs.pData), size(rhs.size), strides(rhs.strides), capacity(rhs.capacity), headroom(rhs.headroom), allocator(rhs.allocator)
         {
-            *this = std::move(rhs);
+            rhs.pData = nullptr;
+            rhs.size = BUFFER_SIZE_ZERO;
+            rhs.strides = BUFFER_SIZE_ZERO;
+            rhs.capacity = 0;
+            rhs.headroom = 0;
         }
 
         /** @copydoc destructor */
@@ -186,7 +262,7 @@ namespace Heph
 
             if constexpr (NDimensions == 1)
             {
-                Buffer::Reallocate(this->pData, 0, rhs.size(), ALLOC_UNINITIALIZED);
+                if (rhs.size() > this->capacity) this->Reallocate(0, rhs.size(), ALLOC_UNINITIALIZED);
                 this->size = rhs.size();
                 this->CalcStrides();
 
@@ -201,7 +277,8 @@ namespace Heph
 
                     if (temp.ElementCount() == 0) return *this;
 
-                    Buffer::Reallocate(this->pData, 0, temp.ElementCount() * rhs.size(), ALLOC_UNINITIALIZED);
+                    const size_t newElementCount = temp.ElementCount() * rhs.size();
+                    if (newElementCount > this->capacity) this->Reallocate(0, newElementCount, ALLOC_UNINITIALIZED);
                     if constexpr (NDimensions == 2)
                         this->size[1] = temp.Size();
                     else
@@ -250,14 +327,24 @@ namespace Heph
         {
             if (&rhs != this)
             {
+                if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (this->allocator != rhs.allocator) this->Release();
+                    this->allocator = rhs.allocator;
+                }
+
                 const size_t newElementCount = rhs.ElementCount();
                 if (newElementCount > 0)
                 {
-                    Buffer::Reallocate(this->pData, this->ElementCount(), newElementCount, ALLOC_UNINITIALIZED);
+                    if (newElementCount > this->capacity) this->Reallocate(0, newElementCount, ALLOC_UNINITIALIZED);
                     this->size = rhs.size;
                     this->strides = rhs.strides;
 
-                    (void)std::copy(rhs.begin(), rhs.end(), this->begin());
+                    // both buffers have the same layout now
+                    if constexpr (std::is_trivially_copyable_v<TData>)
+                        (void)std::memcpy(this->pData, rhs.pData, newElementCount * sizeof(TData));
+                    else
+                        (void)std::copy(rhs.begin(), rhs.end(), this->begin());
                 }
             }
 
@@ -267,22 +354,42 @@ namespace Heph
         /**
          * Moves the contents of ``rhs``.
          *
+         * @note If the allocators are not equal and do not propagate, the elements are copied instead.
+         *
          * @param rhs Instance to move.
          * @return Reference to current instance.
          */
-        Buffer& operator=(Buffer&& rhs) noexcept
+        Buffer& operator=(Buffer&& rhs) noexcept(allocator_traits::propagate_on_container_move_assignment::value || allocator_traits::is_always_equal::value)
         {
             if (&rhs != this)
             {
+                if constexpr (!allocator_traits::propagate_on_container_move_assignment::value && !allocator_traits::is_always_equal::value)
+                {
+                    if (this->allocator != rhs.allocator)
+                    {
+                        this->Release();
+                        *this = static_cast<const Buffer&>(rhs);
+                        rhs.Release();
+                        return *this;
+                    }
+                }
+
                 this->Release();
 
+                if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+                    this->allocator = rhs.allocator;
+
                 this->pData = rhs.pData;
                 this->size = rhs.size;
                 this->strides = rhs.strides;
+                this->capacity = rhs.capacity;
+                this->headroom = rhs.headroom;
 
                 rhs.pData = nullptr;
                 rhs.size = BUFFER_SIZE_ZERO;
                 rhs.strides = BUFFER_SIZE_ZERO;
+                rhs.capacity = 0;
+                rhs.headroom = 0;
             }
 
             return *this;
@@ -367,12 +474,208 @@ namespace Heph
             else return this->size[dim];
         }
 
+        /** Gets the number of elements to advance in one step for each dimension. */
+        const buffer_size_t& Strides() const
+        {
+            return this->strides;
+        }
+
         /** Gets the total number of elements. */
         size_t ElementCount() const
         {
             return Buffer::ElementCount(this->size);
         }
 
+        /** @copydoc BufferView::IsContiguous */
+        bool IsContiguous() const
+        {
+            return this->View().IsContiguous();
+        }
+
+        /**
+         * Reorders the elements in memory so that they are laid out in row-major order.
+         * Pays the reordering cost of an in-place transpose once, so that the following operations can use the contiguous fast paths.
+         *
+         * @note Does nothing if the buffer is already contiguous.
+         *
+         * @exception InsufficientMemoryException
+         */
+        void MakeContiguous()
+        {
+            this->MakeContiguous(Execution::par);
+        }
+
+        /**
+         * @copydoc MakeContiguous()
+         *
+         * @param policy Specifies whether large buffers can be reordered by multiple threads.
+         */
+        template<ExecutionPolicy TPolicy>
+        void MakeContiguous(const TPolicy& policy)
+        {
+            if (this->IsEmpty() || this->IsContiguous()) return;
+
+            const size_t elementCount = this->ElementCount();
+
+            Buffer temp(this->allocator);
+            temp.pData = temp.Allocate(elementCount, ALLOC_UNINITIALIZED);
+            temp.capacity = elementCount;
+
+            Buffer::CopyToContiguous(policy, this->View(), temp.pData);
+
+            this->SwapMemory(temp);
+            this->CalcStrides();
+        }
+
+        /**
+         * Creates a view over all elements.
+         *
+         * @note The view becomes invalid when the buffer is released or reallocated.
+         */
+        view_type View()
+        {
+            return view_type(this->pData, this->size, this->strides);
+        }
+
+        /** @copydoc View */
+        const_view_type View() const
+        {
+            return const_view_type(this->pData, this->size, this->strides);
+        }
+
+        /**
+         * Creates a view over a section of the provided dimension without copying the elements.
+         *
+         * @note The view becomes invalid when the buffer is released or reallocated.
+         *
+         * @param dim 0-based dimension to slice.
+         * @param start Index of the first entry in the dimension.
+         * @param count Number of entries the view will have in the dimension.
+         * @param step Number of entries to advance between two consecutive entries of the view.
+         * @exception InvalidArgumentException
+         */
+        view_type Slice(size_t dim, size_t start, size_t count, size_t step = 1)
+        {
+            return this->View().Slice(dim, start, count, step);
+        }
+
+        /** @copydoc Slice */
+        const_view_type Slice(size_t dim, size_t start, size_t count, size_t step = 1) const
+        {
+            return this->View().Slice(dim, start, count, step);
+        }
+
+        /**
+         * Replaces each element with the result of invoking the function with it.
+         *
+         * @note Large buffers are processed in parallel, see BufferTransform.
+         *
+         * @param func Function that computes the new value of an element, ``TData func(const TData& element)``.
+         */
+        template<typename TFunction>
+            requires BufferTransformFunction<TFunction, TData, const TData>
+        void Apply(TFunction func)
+        {
+            BufferTransform::Apply(this->View(), func);
+        }
+
+        /**
+         * @copydoc Apply(TFunction)
+         *
+         * @param policy Specifies whether large buffers can be split across threads.
+         */
+        template<ExecutionPolicy TPolicy, typename TFunction>
+            requires BufferTransformFunction<TFunction, TData, const TData>
+        void Apply(const TPolicy& policy, TFunction func)
+        {
+            BufferTransform::Apply(policy, this->View(), func);
+        }
+
+        /** Gets the number of elements the allocated memory can hold, starting from the first element. */
+        size_t Capacity() const
+        {
+            return this->capacity;
+        }
+
+        /** Gets the number of elements that can be prepended without reallocating. */
+        size_t FrontCapacity() const
+        {
+            return this->headroom;
+        }
+
+        /**
+         * Increases the capacity to at least the provided number of elements.
+         *
+         * @note Does nothing if the current capacity is already sufficient.
+         *
+         * @param elementCount Number of elements the allocated memory should be able to hold.
+         * @exception InsufficientMemoryException
+         */
+        void Reserve(size_t elementCount)
+        {
+            if (elementCount > this->capacity)
+                this->Reallocate(this->ElementCount(), elementCount, ALLOC_UNINITIALIZED);
+        }
+
+        /**
+         * Reserves memory before the first element so that the provided number of elements can be prepended without reallocating.
+         *
+         * @note Does nothing if the current front capacity is already sufficient.
+         *
+         * @param elementCount Number of elements the memory before the first element should be able to hold.
+         * @exception InsufficientMemoryException
+         */
+        void ReserveFront(size_t elementCount)
+        {
+            if (elementCount > this->headroom)
+                this->ReallocateFront(elementCount);
+        }
+
+        /**
+         * Reduces the capacity to the number of elements and releases the front capacity.
+         *
+         * @exception InsufficientMemoryException
+         */
+        void ShrinkToFit()
+        {
+            const size_t elementCount = this->ElementCount();
+            if (elementCount == this->capacity && this->headroom == 0) return;
+
+            if (elementCount == 0)
+            {
+                allocator_traits::deallocate(this->allocator, this->pData - this->headroom, this->headroom + this->capacity);
+                this->pData = nullptr;
+                this->capacity = 0;
+                this->headroom = 0;
+                return;
+            }
+
+            if (this->headroom > 0)
+            {
+                TData* pBase = this->pData - this->headroom;
+                (void)std::move(this->pData, this->pData + elementCount, pBase);
+
+                this->pData = pBase;
+                this->capacity += this->headroom;
+                this->headroom = 0;
+            }
+
+            if (elementCount == this->capacity)
+            {
+                return;
+            }
+            else
+            {
+                this->Reallocate(elementCount, elementCount, ALLOC_UNINITIALIZED);
+            }
+        }
+
+        /** Gets the allocator used for managing the memory. */
+        const allocator_type& Allocator() const
+        {
+            return this->allocator;
+        }
+
         /**
          * @copydoc operator[]
          *
@@ -422,9 +725,11 @@ namespace Heph
 
             if (this->pData != nullptr)
             {
-                free(this->pData);
+                allocator_traits::deallocate(this->allocator, this->pData - this->headroom, this->headroom + this->capacity);
                 this->pData = nullptr;
             }
+            this->capacity = 0;
+            this->headroom = 0;
         }
 
         /** Returns an iterator to the beginning. */
@@ -527,7 +832,7 @@ namespace Heph
         }
 
         /**
-         * Allocates memory.
+         * Allocates memory using the buffer's allocator.
          *
          * @param elementCount Number of elements to allocate.
          * @param init Indicates whether to initialize the memory after successfull allocation.
@@ -535,15 +840,19 @@ namespace Heph
          * @exception InvalidArgumentException
          * @exception InsufficientMemoryException
          */
-        static TData* Allocate(size_t elementCount, bool init)
+        TData* Allocate(size_t elementCount, bool init)
         {
             if (elementCount == 0)
             {
                 HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Element count cannot be 0.");
             }
 
-            TData* pData = reinterpret_cast<TData*>(malloc(elementCount * sizeof(TData)));
-            if (pData == nullptr)
+            TData* pData = nullptr;
+            try
+            {
+                pData = allocator_traits::allocate(this->allocator, elementCount);
+            }
+            catch (const std::bad_alloc&)
             {
                 HEPH_EXCEPTION_RAISE_AND_THROW(InsufficientMemoryException, HEPH_FUNC, std::format("Failed to allocate {} bytes.", elementCount * sizeof(TData)));
             }
@@ -561,38 +870,216 @@ namespace Heph
         }
 
         /**
-         * Reallocates memory.
+         * Reallocates the memory of the buffer using the buffer's allocator.
+         *
+         * @note If the allocator cannot resize the memory in place,
+         * first ``oldElementCount`` elements are moved to the new memory.
+         * The front capacity is preserved.
          *
-         * @param pData Pointer to the data that will be reallocated.
          * @param oldElementCount Old number of elements.
          * @param newElementCount New number of elements.
          * @param init Indicates whether to initialize the memory after successfull allocation.
          * @exception InvalidArgumentException
          * @exception InsufficientMemoryException
          */
-        static void Reallocate(TData*& pData, size_t oldElementCount, size_t newElementCount, bool init)
+        void Reallocate(size_t oldElementCount, size_t newElementCount, bool init)
         {
             if (newElementCount == 0)
             {
                 HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "New element count cannot be 0.");
             }
 
-            TData* pTemp = reinterpret_cast<TData*>(realloc(pData, newElementCount * sizeof(TData)));
-            if (pTemp == nullptr)
+            if constexpr (ReallocatableBufferAllocator<allocator_type, TData>)
             {
-                HEPH_EXCEPTION_RAISE_AND_THROW(InsufficientMemoryException, HEPH_FUNC, std::format("Failed to reallocate {} bytes.", newElementCount * sizeof(TData)));
+                TData* pBase = (this->pData != nullptr) ? (this->pData - this->headroom) : nullptr;
+                this->pData = this->allocator.reallocate(pBase, this->headroom + this->capacity, this->headroom + newElementCount) + this->headroom;
             }
+            else
+            {
+                TData* pTemp = this->Allocate(this->headroom + newElementCount, ALLOC_UNINITIALIZED) + this->headroom;
+                if (this->pData != nullptr)
+                {
+                    const size_t moveCount = std::min({ oldElementCount, newElementCount, this->capacity });
+                    (void)std::move(this->pData, this->pData + moveCount, pTemp);
+                    allocator_traits::deallocate(this->allocator, this->pData - this->headroom, this->headroom + this->capacity);
+                }
+                this->pData = pTemp;
+            }
+            this->capacity = newElementCount;
 
             if (init && newElementCount > oldElementCount)
             {
                 std::fill(
-                    (pTemp + oldElementCount),
-                    (pTemp + newElementCount),
+                    (this->pData + oldElementCount),
+                    (this->pData + newElementCount),
                     TData()
                 );
             }
+        }
+
+        /**
+         * Moves the elements to a new memory that has the provided number of unused elements before the first element.
+         *
+         * @param newHeadroom Number of unused elements to allocate before the first element.
+         * @exception InsufficientMemoryException
+         */
+        void ReallocateFront(size_t newHeadroom)
+        {
+            const size_t elementCount = this->ElementCount();
+            TData* pTemp = this->Allocate(newHeadroom + this->capacity, ALLOC_UNINITIALIZED) + newHeadroom;
+
+            if (this->pData != nullptr)
+            {
+                (void)std::move(this->pData, this->pData + std::min(elementCount, this->capacity), pTemp);
+                allocator_traits::deallocate(this->allocator, this->pData - this->headroom, this->headroom + this->capacity);
+            }
+
+            this->pData = pTemp;
+            this->headroom = newHeadroom;
+        }
+
+        /**
+         * Swaps the memory of two buffers without modifying their sizes or strides.
+         *
+         * @param rhs Buffer to swap memory with.
+         */
+        void SwapMemory(Buffer& rhs) noexcept
+        {
+            std::swap(this->pData, rhs.pData);
+            std::swap(this->capacity, rhs.capacity);
+            std::swap(this->headroom, rhs.headroom);
+        }
+
+        /** Gets the number of elements each top-level entry has. */
+        size_t EntryElementCount() const
+        {
+            if constexpr (NDimensions == 1) return 1;
+            else return std::accumulate(this->size.begin() + 1, this->size.end(), 1uz, std::multiplies<size_t>());
+        }
+
+        /**
+         * Copies top-level entries from the source buffer to the destination buffer.
+         * Source and destination ranges may overlap.
+         *
+         * @note Collapses to a single ``memmove`` if ``TData`` is trivially copyable and both buffers are contiguous,
+         * otherwise the elements are copied one by one via iterators.
+         *
+         * @param src The buffer whose entries will be copied.
+         * @param srcIndex Index of the first top-level entry to copy.
+         * @param dest The buffer to which entries will be copied.
+         * @param destIndex Index of the top-level entry to copy the first entry to.
+         * @param count Number of top-level entries to copy.
+         */
+        static void CopyEntries(const Buffer& src, size_t srcIndex, Buffer& dest, size_t destIndex, size_t count)
+        {
+            if (count == 0) return;
+
+            if constexpr (std::is_trivially_copyable_v<TData>)
+            {
+                if (src.IsContiguous() && dest.IsContiguous())
+                {
+                    const size_t entryElementCount = src.EntryElementCount();
+                    (void)std::memmove(
+                        dest.pData + destIndex * entryElementCount,
+                        src.pData + srcIndex * entryElementCount,
+                        count * entryElementCount * sizeof(TData)
+                    );
+                    return;
+                }
+            }
+
+            const_iterator itSrcBegin = src.cbegin();
+            itSrcBegin.IncrementIndex(0, srcIndex);
+
+            const_iterator itSrcEnd = itSrcBegin;
+            itSrcEnd.IncrementIndex(0, count);
+
+            iterator itDest = dest.begin();
+            itDest.IncrementIndex(0, destIndex);
+
+            if (&src == &dest && destIndex > srcIndex)
+            {
+                itDest.IncrementIndex(0, count);
+                (void)std::copy_backward(itSrcBegin, itSrcEnd, itDest);
+            }
+            else
+            {
+                (void)std::copy(itSrcBegin, itSrcEnd, itDest);
+            }
+        }
+
+        /** Copies the elements of a view to contiguous memory in row-major order, large views are copied in parallel. */
+        static void CopyToContiguous(const const_view_type& view, TData* pDest)
+        {
+            Buffer::CopyToContiguous(Execution::par, view, pDest);
+        }
+
+        /**
+         * Copies the elements of a view to contiguous memory in row-major order.
+         *
+         * @note Unless the policy is sequenced, large views are split along the first dimension and the chunks are copied in parallel,
+         * each with the tiled kernel of BufferView::CopyTo.
+         *
+         * @param policy Specifies whether large views can be copied by multiple threads.
+         * @param view The view whose elements will be copied.
+         * @param pDest Pointer to the memory that can hold at least ``view.ElementCount()`` elements.
+         */
+        template<ExecutionPolicy TPolicy>
+        static void CopyToContiguous(const TPolicy& policy, const const_view_type& view, TData* pDest)
+        {
+            const size_t entryCount = view.Size(0);
+            const size_t entryElementCount = (entryCount > 0) ? (view.ElementCount() / entryCount) : 0;
+            if (entryElementCount == 0) return;
+
+            const size_t grainSize = (PARALLEL_COPY_GRAIN_SIZE + entryElementCount - 1) / entryElementCount;
+            Parallel::For(policy, 0, entryCount, grainSize, [&view, pDest, entryElementCount](size_t begin, size_t end)
+                {
+                    view.Slice(0, begin, end - begin).CopyTo(pDest + begin * entryElementCount);
+                });
+        }
+
+        /**
+         * Sets the elements of top-level entries to default value.
+         *
+         * @param buffer The buffer whose entries will be reset.
+         * @param index Index of the first top-level entry to reset.
+         * @param count Number of top-level entries to reset.
+         */
+        static void ResetEntries(Buffer& buffer, size_t index, size_t count)
+        {
+            if (count == 0) return;
+
+            if (buffer.IsContiguous())
+            {
+                const size_t entryElementCount = buffer.EntryElementCount();
+                TData* pBegin = buffer.pData + index * entryElementCount;
+                std::fill(pBegin, pBegin + count * entryElementCount, TData());
+                return;
+            }
+
+            iterator itBegin = buffer.begin();
+            itBegin.IncrementIndex(0, index);
+
+            iterator itEnd = itBegin;
+            itEnd.IncrementIndex(0, count);
 
-            pData = pTemp;
+            std::fill(itBegin, itEnd, TData());
+        }
+
+        /**
+         * Ensures the allocated memory can hold at least the provided number of elements.
+         * If not, the capacity is grown geometrically so that repeated insertions take amortized constant time per element.
+         *
+         * @param minElementCount Minimum number of elements the allocated memory must be able to hold.
+         * @exception InsufficientMemoryException
+         */
+        void Grow(size_t minElementCount)
+        {
+            if (minElementCount > this->capacity)
+            {
+                const size_t newCapacity = std::max(minElementCount, this->capacity + (this->capacity / 2));
+                this->Reallocate(this->ElementCount(), newCapacity, ALLOC_UNINITIALIZED);
+            }
         }
 
         /**
@@ -619,16 +1106,10 @@ namespace Heph
                 return;
             }
 
-            iterator itBegin = buffer.begin();
-            itBegin.IncrementIndex(0, n);
-
-            (void)std::move(itBegin, buffer.end(), buffer.begin());
+            Buffer::CopyEntries(buffer, n, buffer, 0, buffer.Size(0) - n);
 
             // set the invalid entries at the end to default value
-            itBegin = buffer.end();
-            itBegin.DecrementIndex(0, n);
-
-            std::fill(itBegin, buffer.end(), TData());
+            Buffer::ResetEntries(buffer, buffer.Size(0) - n, n);
         }
 
         /**
@@ -655,15 +1136,8 @@ namespace Heph
                 return;
             }
 
-            iterator itSrcEnd = buffer.end();
-            itSrcEnd.DecrementIndex(0, n);
-
-            (void)std::move_backward(buffer.begin(), itSrcEnd, buffer.end());
-
-            iterator itDestBegin = buffer.begin();
-            itDestBegin.IncrementIndex(0, n);
-
-            std::fill(buffer.begin(), itDestBegin, TData());
+            Buffer::CopyEntries(buffer, 0, buffer, n, buffer.Size(0) - n);
+            Buffer::ResetEntries(buffer, 0, n);
         }
 
         /**
@@ -687,20 +1161,12 @@ namespace Heph
 
             if (size == 0) return;
 
-            buffer_size_t oldSize = src.size; // do not initialize the section that will be copied.
             buffer_size_t newSize = src.size;
-            if constexpr (NDimensions == 1)
-            {
-                oldSize -= index;
-                newSize = size;
-            }
-            else
-            {
-                oldSize[0] -= index;
-                newSize[0] = size;
-            }
+            if constexpr (NDimensions == 1) newSize = size;
+            else newSize[0] = size;
 
-            Buffer::Reallocate(dest.pData, Buffer::ElementCount(oldSize), Buffer::ElementCount(newSize), ALLOC_INITIALIZED);
+            const size_t newElementCount = Buffer::ElementCount(newSize);
+            if (newElementCount > dest.capacity) dest.Reallocate(0, newElementCount, ALLOC_UNINITIALIZED);
             dest.size = newSize;
             dest.CalcStrides();
 
@@ -709,18 +1175,17 @@ namespace Heph
                 size = src.Size(0) - index;
             }
 
-            const_iterator itSrcStart = src.cbegin();
-            itSrcStart.IncrementIndex(0, index);
-
-            const_iterator itSrcEnd = src.cbegin();
-            itSrcEnd.IncrementIndex(0, index + size);
-
-            (void)std::copy(itSrcStart, itSrcEnd, dest.begin());
+            Buffer::CopyEntries(src, index, dest, 0, size);
+            Buffer::ResetEntries(dest, size, dest.Size(0) - size); // entries past the end of the source
         }
 
         /**
          * Prepends the elements of the source buffer to the destination buffer.
          *
+         * @note Elements are written to the front capacity if possible, which is grown geometrically when exhausted.
+         * Hence the first element may not be aligned to the allocator's alignment after prepending,
+         * it is realigned only when the front capacity is grown since the elements are copied then anyway.
+         *
          * @param dest The buffer to which elements will be prepended.
          * @param src The buffer whose elements will be prepended to the destination.
          * @exception InvalidOperationException
@@ -743,23 +1208,26 @@ namespace Heph
                 }
             }
 
-            Buffer::Reallocate(dest.pData, dest.ElementCount(), dest.ElementCount() + src.ElementCount(), ALLOC_UNINITIALIZED);
+            const size_t srcElementCount = src.ElementCount();
+            const size_t srcTopLevelCount = src.Size(0);
 
-            if (&dest == &src)
+            if (srcElementCount > dest.headroom)
             {
-                (void)std::copy(dest.begin(), dest.end(), dest.end());
-
-                if constexpr (NDimensions == 1) dest.size += src.size;
-                else dest.size[0] += src.size[0];
-
-                return;
+                // grow the front capacity geometrically so that repeated prepends take amortized constant time per element,
+                // and round the capacity left after prepending to the aligned step so that the new first element is aligned.
+                const size_t remainingHeadroom = std::max(srcElementCount, dest.headroom + dest.ElementCount()) - srcElementCount;
+                dest.ReallocateFront((remainingHeadroom + ALIGNED_ELEMENT_STEP - 1) / ALIGNED_ELEMENT_STEP * ALIGNED_ELEMENT_STEP + srcElementCount);
             }
 
-            if constexpr (NDimensions == 1) dest.size += src.size;
-            else dest.size[0] += src.size[0];
+            dest.pData -= srcElementCount;
+            dest.headroom -= srcElementCount;
+            dest.capacity += srcElementCount;
 
-            Buffer::ShiftRight(dest, src.Size(0));
-            (void)std::copy(src.begin(), src.end(), dest.begin());
+            if constexpr (NDimensions == 1) dest.size += srcTopLevelCount;
+            else dest.size[0] += srcTopLevelCount;
+
+            if (&dest == &src) Buffer::CopyEntries(dest, srcTopLevelCount, dest, 0, srcTopLevelCount);
+            else Buffer::CopyEntries(src, 0, dest, 0, srcTopLevelCount);
         }
 
         /**
@@ -789,8 +1257,8 @@ namespace Heph
                 }
             }
 
-            Buffer::Reallocate(dest.pData, dest.ElementCount(), dest.ElementCount() + src.ElementCount(), ALLOC_UNINITIALIZED);
-            (void)std::copy(src.begin(), src.end(), dest.end()); // dest size is not updated yet
+            dest.Grow(dest.ElementCount() + src.ElementCount());
+            Buffer::CopyEntries(src, 0, dest, dest.Size(0), src.Size(0)); // dest size is not updated yet
 
             if constexpr (NDimensions == 1) dest.size += src.size;
             else dest.size[0] += src.size[0];
@@ -833,29 +1301,21 @@ namespace Heph
                 }
             }
 
-            Buffer::Reallocate(dest.pData, dest.ElementCount(), dest.ElementCount() + src.ElementCount(), ALLOC_UNINITIALIZED);
-
-            iterator itInsertBegin = dest.begin();
-            itInsertBegin.IncrementIndex(0, index);
+            dest.Grow(dest.ElementCount() + src.ElementCount());
 
-            iterator itShiftDestBegin = itInsertBegin;
-            itShiftDestBegin.IncrementIndex(0, src.Size(0));
+            const size_t srcTopLevelCount = src.Size(0);
+            const size_t destTopLevelCount = dest.Size(0);
 
-            iterator itShiftDestEnd = dest.end();
-            itShiftDestEnd.IncrementIndex(0, src.Size(0));
-
-            (void)std::move_backward(itInsertBegin, dest.end(), itShiftDestEnd); // shift right side of the dest buffer
+            Buffer::CopyEntries(dest, index, dest, index + srcTopLevelCount, destTopLevelCount - index); // shift right side of the dest buffer
 
             if (&dest == &src)
             {
-                (void)std::copy(dest.begin(), itInsertBegin, itInsertBegin); // left side
-
-                itInsertBegin.IncrementIndex(0, index);
-                (void)std::copy(itShiftDestBegin, itShiftDestEnd, itInsertBegin); // right side
+                Buffer::CopyEntries(dest, 0, dest, index, index); // left side
+                Buffer::CopyEntries(dest, index + srcTopLevelCount, dest, 2 * index, srcTopLevelCount - index); // right side
             }
             else
             {
-                (void)std::copy(src.begin(), src.end(), itInsertBegin);
+                Buffer::CopyEntries(src, 0, dest, index, srcTopLevelCount);
             }
 
             if constexpr (NDimensions == 1) dest.size += src.size;
@@ -865,6 +1325,10 @@ namespace Heph
         /**
          * Removes a section of the buffer.
          *
+         * @note For contiguous buffers, the smaller of the two remaining sides is moved over the removed section in place,
+         * hence no memory is allocated. The freed memory is kept as capacity, use ShrinkToFit to release it.
+         * Hence the first element may not be aligned to the allocator's alignment after removing a section near the front.
+         *
          * @param buffer The buffer to be cut.
          * @param index Index of the first top-level entry that will be removed.
          * @param size Number of top-level entries to remove.
@@ -897,24 +1361,34 @@ namespace Heph
             else
                 newSize[0] -= size;
 
-            Buffer temp(newSize);
+            if (buffer.IsContiguous())
+            {
+                const size_t tailCount = buffer.Size(0) - index - size;
+                if (static_cast<size_t>(index) < tailCount)
+                {
+                    // move the head right, then the removed entries become front capacity
+                    Buffer::CopyEntries(buffer, 0, buffer, size, index);
 
-            const_iterator itBuffer = buffer.cbegin();
-            itBuffer.IncrementIndex(0, index);
+                    const size_t cutElementCount = buffer.ElementCount() - Buffer::ElementCount(newSize);
+                    buffer.pData += cutElementCount;
+                    buffer.headroom += cutElementCount;
+                    buffer.capacity -= cutElementCount;
+                }
+                else
+                {
+                    Buffer::CopyEntries(buffer, index + size, buffer, index, tailCount);
+                }
 
-            if (index > 0)
-                (void)std::move(buffer.cbegin(), itBuffer, temp.begin());
+                buffer.size = newSize;
+                return;
+            }
 
-            if (index + size < buffer.Size(0))
-            {
-                iterator itTemp = temp.begin();
-                itTemp.IncrementIndex(0, index);
-                itBuffer.IncrementIndex(0, size);
+            Buffer temp(newSize, buffer.allocator);
 
-                (void)std::move(itBuffer, buffer.cend(), itTemp);
-            }
+            Buffer::CopyEntries(buffer, 0, temp, 0, index);
+            Buffer::CopyEntries(buffer, index + size, temp, index, buffer.Size(0) - index - size);
 
-            std::swap(buffer.pData, temp.pData);
+            buffer.SwapMemory(temp);
 
             buffer.size = newSize;
             buffer.CalcStrides();
@@ -945,31 +1419,22 @@ namespace Heph
                 HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Invalid size.");
             }
 
-            if (&b1 == &b2)
-            {
-                Buffer temp = b2;
-                Buffer::Replace(temp, b2, b1Index, b2Index, size);
-                std::swap(b1.pData, temp.pData);
-                return;
-            }
-
-            iterator itB1Begin = b1.begin();
-            itB1Begin.IncrementIndex(0, b1Index);
-
-            const_iterator itB2Begin = b2.begin();
-            itB2Begin.IncrementIndex(0, b2Index);
-
-            const_iterator itB2End = itB2Begin;
-            itB2End.IncrementIndex(0, size);
+            Buffer::CopyEntries(b2, b2Index, b1, b1Index, size);
+        }
 
-            (void)std::copy(itB2Begin, itB2End, itB1Begin);
+        /** Transposes a multidimensional buffer, large buffers are reordered in parallel. */
+        static void Transpose(const Buffer& src, Buffer& dest, const buffer_size_t& perm, Enum<TransposeMode> mode)
+        {
+            Buffer::Transpose(Execution::par, src, dest, perm, mode);
         }
 
         /**
          * Transposes a multidimensional buffer.
          *
          * @note This method allocates memory for the destination buffer, hence no need to allocate in advance.
+         * Unless the mode is TransposeMode::InPlace, the elements are reordered in cache-sized tiles and, unless the policy is sequenced, large buffers are split across threads.
          *
+         * @param policy Specifies whether large buffers can be reordered by multiple threads.
          * @param src The source buffer.
          * @param dest The destination buffer.
          * @param perm Permutation of the dimensions.
@@ -978,7 +1443,8 @@ namespace Heph
          * @exception InvalidArgumentException
          * @exception InsufficientMemoryException
          */
-        static void Transpose(const Buffer& src, Buffer& dest, const buffer_size_t& perm, Enum<TransposeMode> mode)
+        template<ExecutionPolicy TPolicy>
+        static void Transpose(const TPolicy& policy, const Buffer& src, Buffer& dest, const buffer_size_t& perm, Enum<TransposeMode> mode)
         {
             if constexpr (NDimensions == 1 || !std::equality_comparable<TData>)
             {
@@ -991,8 +1457,8 @@ namespace Heph
 
                 if (sameInstance && !inPlace)
                 {
-                    Buffer temp;
-                    Buffer::Transpose(src, temp, perm, mode);
+                    Buffer temp(dest.allocator);
+                    Buffer::Transpose(policy, src, temp, perm, mode);
                     dest = std::move(temp);
                     return;
                 }
@@ -1016,7 +1482,7 @@ namespace Heph
 
                 if (!sameInstance)
                 {
-                    Buffer::Reallocate(dest.pData, dest.ElementCount(), src.ElementCount(), ALLOC_UNINITIALIZED);
+                    if (src.ElementCount() > dest.capacity) dest.Reallocate(0, src.ElementCount(), ALLOC_UNINITIALIZED);
                     dest.size = src.size;
                     dest.strides = src.strides;
                 }
@@ -1049,37 +1515,40 @@ namespace Heph
                 }
                 else
                 {
+                    // view of the source with the dimensions permuted, copying it in row-major order is the transpose
+                    buffer_size_t permutedStrides;
                     for (size_t d = 0; d < NDimensions; ++d)
                     {
                         dest.size[d] = src.size[perm[d]];
+                        permutedStrides[d] = src.strides[perm[d]];
                     }
                     dest.CalcStrides();
 
-                    // optimize this later
-                    const const_iterator itEnd = src.cend();
-                    for (const_iterator it = src.cbegin(); it != itEnd; ++it)
-                    {
-                        buffer_index_t outputIndices = BUFFER_INDEX_ZERO;
-                        for (size_t d = 0; d < NDimensions; ++d)
-                        {
-                            outputIndices[d] = it.Indices()[perm[d]];
-                        }
-                        dest[outputIndices] = *it;
-                    }
+                    Buffer::CopyToContiguous(policy, const_view_type(src.pData, dest.size, permutedStrides), dest.pData);
                 }
             }
         }
 
+        /** Changes the size of the buffer, the kept elements of large multidimensional buffers are copied in parallel. */
+        static void Resize(Buffer& buffer, const buffer_size_t& newSize)
+        {
+            Buffer::Resize(Execution::par, buffer, newSize);
+        }
+
         /**
          * Changes the size of the buffer.<br>
          * If the new size is less than the old, elements at the end will be removed.
          *
+         * @note The allocated memory is not released when the buffer shrinks, use ShrinkToFit to release it.
+         *
+         * @param policy Specifies whether the kept elements of a multidimensional buffer can be copied by multiple threads.
          * @param buffer The buffer to be resized.
          * @param newSize New size of the buffer.
          * @exception InvalidArgumentException
          * @exception InsufficientMemoryException
          */
-        static void Resize(Buffer& buffer, const buffer_size_t& newSize)
+        template<ExecutionPolicy TPolicy>
+        static void Resize(const TPolicy& policy, Buffer& buffer, const buffer_size_t& newSize)
         {
             const size_t newElementCount = Buffer::ElementCount(newSize);
             if (newElementCount == 0)
@@ -1090,24 +1559,28 @@ namespace Heph
             {
                 if constexpr (NDimensions == 1)
                 {
-                    Buffer::Reallocate(buffer.pData, buffer.ElementCount(), newElementCount, ALLOC_INITIALIZED);
+                    const size_t oldElementCount = buffer.ElementCount();
+                    if (newElementCount > buffer.capacity)
+                        buffer.Reallocate(oldElementCount, newElementCount, ALLOC_INITIALIZED);
+                    else if (newElementCount > oldElementCount)
+                        std::fill(buffer.pData + oldElementCount, buffer.pData + newElementCount, TData());
                 }
                 else
                 {
-                    Buffer temp(newSize);
+                    Buffer temp(newSize, buffer.allocator);
 
-                    iterator it = temp.begin();
-                    iterator itEnd = temp.end();
-                    for (; it != itEnd; ++it)
+                    // copy the region both sizes share, the rest of temp is already default initialized
+                    view_type destView = temp.View();
+                    const_view_type srcView = buffer.View();
+                    for (size_t d = 0; d < NDimensions; ++d)
                     {
-                        const buffer_index_t indices = it.Indices();
-                        if (std::ranges::equal(indices, buffer.size, std::less()))
-                            *it = buffer[indices];
-                        else
-                            *it = TData();
+                        const size_t keptCount = std::min(buffer.size[d], newSize[d]);
+                        destView = destView.Slice(d, 0, keptCount);
+                        srcView = srcView.Slice(d, 0, keptCount);
                     }
+                    BufferTransform::Transform(policy, destView, [](const TData& element) -> const TData& { return element; }, srcView);
 
-                    std::swap(buffer.pData, temp.pData);
+                    buffer.SwapMemory(temp);
                 }
 
                 buffer.size = newSize;
@@ -1115,14 +1588,24 @@ namespace Heph
             }
         }
 
+        /** Swaps the elements of the provided dimension, large contiguous buffers are reversed in parallel. */
+        static void Reverse(Buffer& buffer, size_t dim)
+        {
+            Buffer::Reverse(Execution::par, buffer, dim);
+        }
+
         /**
          * Swaps the elements of the provided dimension.
          *
+         * @note Unless the policy is sequenced, large contiguous buffers are reversed by multiple threads.
+         *
+         * @param policy Specifies whether large buffers can be reversed by multiple threads.
          * @param buffer The buffer to be reversed.
          * @param dim 0-based dimension that will be reversed.
          * @exception InvalidArgumentException
          */
-        static void Reverse(Buffer& buffer, size_t dim)
+        template<ExecutionPolicy TPolicy>
+        static void Reverse(const TPolicy& policy, Buffer& buffer, size_t dim)
         {
             if (dim >= NDimensions)
             {
@@ -1131,11 +1614,40 @@ namespace Heph
 
             if constexpr (NDimensions == 1)
             {
-                const size_t halfSize = buffer.size / 2;
-                for (size_t i = 0; i < halfSize; ++i)
+                TData* const pData = buffer.pData;
+                const size_t size = buffer.size;
+                Parallel::For(policy, 0, size / 2, PARALLEL_COPY_GRAIN_SIZE, [pData, size](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            std::swap(pData[i], pData[size - i - 1]);
+                    });
+            }
+            else if (buffer.IsContiguous())
+            {
+                // swap the blocks after the dimension, which are contiguous, for each pair of indices in the dimension
+                size_t outerCount = 1;
+                size_t innerCount = 1;
+                for (size_t d = 0; d < NDimensions; ++d)
                 {
-                    std::swap(buffer[i], buffer[buffer.size - i - 1]);
+                    if (d < dim) outerCount *= buffer.size[d];
+                    else if (d > dim) innerCount *= buffer.size[d];
                 }
+
+                TData* const pData = buffer.pData;
+                const size_t dimSize = buffer.size[dim];
+                const size_t pairCount = dimSize / 2;
+                if (innerCount == 0 || pairCount == 0) return;
+
+                Parallel::For(policy, 0, outerCount * pairCount, std::max(PARALLEL_COPY_GRAIN_SIZE / innerCount, 1uz), [=](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            const size_t outer = i / pairCount;
+                            const size_t pair = i % pairCount;
+                            TData* const pOuter = pData + outer * dimSize * innerCount;
+                            (void)std::swap_ranges(pOuter + pair * innerCount, pOuter + (pair + 1) * innerCount, pOuter + (dimSize - pair - 1) * innerCount);
+                        }
+                    });
             }
             else
             {
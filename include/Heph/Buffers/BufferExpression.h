@@ -0,0 +1,641 @@
+#ifndef HEPH_BUFFER_EXPRESSION_H
+#define HEPH_BUFFER_EXPRESSION_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/BufferView.h"
+#include "Heph/Exceptions/InvalidOperationException.h"
+#include <functional>
+#include <type_traits>
+#include <concepts>
+#include <vector>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Base class for the lazy element-wise expressions created by the arithmetic operators of the \ref ArithmeticBuffer "ArithmeticBuffer".
+     *
+     * Operators do not compute anything, they combine their operands into an expression tree.
+     * The tree is evaluated in a single pass when it is assigned to a buffer,
+     * hence chained operations such as ``a * g + b - c`` neither allocate temporaries nor read the memory more than once.
+     *
+     * @note Expressions keep views to the buffers they are created from. Evaluate them before the buffers are released or reallocated,
+     * storing an expression with ``auto`` and modifying its operands afterwards results in undefined behavior.
+     *
+     * @tparam TExpression Type of the derived expression.
+     */
+    template<typename TExpression>
+    class HEPH_API BufferExpression
+    {
+    public:
+        /** Gets the derived expression. */
+        HEPH_FORCE_INLINE const TExpression& Derived() const
+        {
+            return static_cast<const TExpression&>(*this);
+        }
+
+        /**
+         * Evaluates the expression and assigns the results to the elements of a view.
+         *
+         * @note Elements are evaluated in place one by one, thus the destination may also be an operand.
+         * If an operand reads the memory of the destination through a view with a different layout (e.g. a broadcast row of the destination),
+         * the expression is evaluated to a temporary first so that no operand is read after it is overwritten.
+         * If the expression is smaller than the destination, it is broadcast to the size of the destination (see BufferView::BroadcastTo).
+         *
+         * @param dest The view whose elements will be assigned.
+         * @param assign Callable that assigns a result to an element of the view, ``assign(destElement, result)``.
+         * @exception InvalidOperationException
+         */
+        template<BufferElement TDestData, size_t NDimensions, typename TAssign>
+        void EvaluateTo(const BufferView<TDestData, NDimensions>& dest, TAssign assign) const
+        {
+            static_assert(NDimensions == TExpression::DIMENSION_COUNT, "Number of dimensions must be the same.");
+
+            const TExpression& expression = this->Derived();
+            if (dest.Size() != expression.Size())
+            {
+                if (!BufferView<const std::remove_const_t<TDestData>, NDimensions>::IsBroadcastable(expression.Size(), dest.Size()))
+                {
+                    HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Size of the expression cannot be broadcast to the size of the buffer.");
+                }
+
+                expression.Broadcast(dest.Size()).EvaluateTo(dest, assign);
+                return;
+            }
+
+            if (expression.Aliases(dest))
+            {
+                std::vector<typename TExpression::value_type> results;
+                results.reserve(dest.ElementCount());
+
+                typename TExpression::const_iterator itExpression = expression.cbegin();
+                for (size_t i = 0; i < dest.ElementCount(); ++i, ++itExpression)
+                    results.push_back(*itExpression);
+
+                typename std::vector<typename TExpression::value_type>::const_iterator itResult = results.cbegin();
+                for (TDestData& element : dest)
+                {
+                    assign(element, *itResult);
+                    ++itResult;
+                }
+                return;
+            }
+
+            if (dest.IsContiguous() && expression.IsContiguous())
+            {
+                TDestData* const pDest = dest.Data();
+                const size_t elementCount = dest.ElementCount();
+                for (size_t i = 0; i < elementCount; ++i)
+                    assign(pDest[i], expression.Element(i));
+            }
+            else
+            {
+                typename TExpression::const_iterator itExpression = expression.cbegin();
+                for (TDestData& element : dest)
+                {
+                    assign(element, *itExpression);
+                    ++itExpression;
+                }
+            }
+        }
+    };
+
+    /** @brief Specifies that the type ``T`` is a lazy buffer expression. */
+    template<typename T>
+    concept BufferExpressionType = std::derived_from<T, BufferExpression<T>>;
+
+    /**
+     * @brief Leaf of an expression tree, reads the elements of a view.
+     *
+     * @tparam TData Type of the elements.
+     * @tparam NDimensions Number of dimensions.
+     */
+    template<BufferElement TData, size_t NDimensions>
+    class HEPH_API BufferViewExpression final : public BufferExpression<BufferViewExpression<TData, NDimensions>>
+    {
+    public:
+        /** @brief Type of the elements the expression produces. */
+        using value_type = TData;
+        /** @brief Type of the read-only view over the elements. */
+        using const_view_type = BufferView<const TData, NDimensions>;
+        /** @brief Type of the iterator that produces the elements in row-major order. */
+        using const_iterator = typename const_view_type::const_iterator;
+        /** @copybrief BufferView::buffer_size_t */
+        using buffer_size_t = typename const_view_type::buffer_size_t;
+
+        /** @brief Number of dimensions. */
+        static constexpr size_t DIMENSION_COUNT = NDimensions;
+        /** @brief Whether the expression is a constant broadcast to all elements. */
+        static constexpr bool IS_SCALAR = false;
+
+    private:
+        /** @brief The view whose elements are read. */
+        const_view_type view;
+
+    public:
+        /**
+         * @copydoc constructor
+         *
+         * @param view The view whose elements are read.
+         */
+        BufferViewExpression(const const_view_type& view)
+            : view(view)
+        {
+        }
+
+        /** Gets the view whose elements are read. */
+        HEPH_FORCE_INLINE const const_view_type& View() const
+        {
+            return this->view;
+        }
+
+        /** @copydoc BufferView::Size() */
+        HEPH_FORCE_INLINE const buffer_size_t& Size() const
+        {
+            return this->view.Size();
+        }
+
+        /** @copydoc BufferView::IsContiguous */
+        HEPH_FORCE_INLINE bool IsContiguous() const
+        {
+            return this->view.IsContiguous();
+        }
+
+        /**
+         * Gets the element at the provided row-major position.
+         *
+         * @note Valid only if the expression is contiguous.
+         */
+        HEPH_FORCE_INLINE const TData& Element(size_t index) const
+        {
+            return this->view.Data()[index];
+        }
+
+        /** Gets an iterator to the first element. */
+        HEPH_FORCE_INLINE const_iterator cbegin() const
+        {
+            return this->view.cbegin();
+        }
+
+        /**
+         * Creates an expression that repeats the elements to a larger size.
+         *
+         * @param size Number of elements in each dimension of the new expression.
+         * @exception InvalidArgumentException
+         */
+        BufferViewExpression Broadcast(const buffer_size_t& size) const
+        {
+            return BufferViewExpression(this->view.BroadcastTo(size));
+        }
+
+        /**
+         * Checks whether the view reads the memory of the destination in a different layout than the destination writes it,
+         * such elements may be overwritten before they are read if the expression is evaluated in place.
+         *
+         * @param dest The view the expression is evaluated to, must have the same size as the expression.
+         */
+        template<BufferElement TDestData>
+        bool Aliases(const BufferView<TDestData, NDimensions>& dest) const
+        {
+            return this->view.Overlaps(dest) && (this->view.Data() != dest.Data() || this->view.Strides() != dest.Strides());
+        }
+    };
+
+    /**
+     * @brief Leaf of an expression tree, a constant that is broadcast to all elements.
+     *
+     * @tparam TData Type of the constant.
+     * @tparam NDimensions Number of dimensions of the expression the constant is used in.
+     */
+    template<BufferElement TData, size_t NDimensions>
+    class HEPH_API BufferScalarExpression final : public BufferExpression<BufferScalarExpression<TData, NDimensions>>
+    {
+    public:
+        /** @copybrief BufferViewExpression::value_type */
+        using value_type = TData;
+
+        /** @brief Iterator that produces the constant. */
+        class const_iterator final
+        {
+        private:
+            /** @brief Pointer to the constant. */
+            const TData* pValue;
+
+        public:
+            /**
+             * @copydoc constructor
+             *
+             * @param pValue Pointer to the constant.
+             */
+            explicit const_iterator(const TData* pValue) : pValue(pValue) {}
+
+            /** Gets the constant. */
+            HEPH_FORCE_INLINE const TData& operator*() const
+            {
+                return *this->pValue;
+            }
+
+            /** Does nothing, the constant is the same for all elements. */
+            HEPH_FORCE_INLINE const_iterator& operator++()
+            {
+                return *this;
+            }
+        };
+
+        /** @copybrief BufferViewExpression::DIMENSION_COUNT */
+        static constexpr size_t DIMENSION_COUNT = NDimensions;
+        /** @copybrief BufferViewExpression::IS_SCALAR */
+        static constexpr bool IS_SCALAR = true;
+
+    private:
+        /** @brief The constant. */
+        TData value;
+
+    public:
+        /**
+         * @copydoc constructor
+         *
+         * @param value The constant.
+         */
+        explicit BufferScalarExpression(const TData& value)
+            : value(value)
+        {
+        }
+
+        /** Gets the constant. */
+        HEPH_FORCE_INLINE const TData& Value() const
+        {
+            return this->value;
+        }
+
+        /** Returns true, the constant does not depend on the position. */
+        HEPH_FORCE_INLINE bool IsContiguous() const
+        {
+            return true;
+        }
+
+        /** Gets the constant. */
+        HEPH_FORCE_INLINE const TData& Element(size_t) const
+        {
+            return this->value;
+        }
+
+        /** @copydoc BufferViewExpression::cbegin */
+        HEPH_FORCE_INLINE const_iterator cbegin() const
+        {
+            return const_iterator(&this->value);
+        }
+
+        /** Gets the expression itself, the constant is already broadcast to all elements. */
+        template<typename TSize>
+        HEPH_FORCE_INLINE const BufferScalarExpression& Broadcast(const TSize&) const
+        {
+            return *this;
+        }
+
+        /** Returns false, the constant is not stored in any buffer. */
+        template<typename TView>
+        HEPH_FORCE_INLINE bool Aliases(const TView&) const
+        {
+            return false;
+        }
+    };
+
+    /**
+     * @brief Node of an expression tree, applies an element-wise binary operation to the results of two expressions.
+     *
+     * @tparam TLhs Type of the left operand.
+     * @tparam TRhs Type of the right operand.
+     * @tparam TOperation Type of the operation, such as ``std::plus<>``.
+     */
+    template<BufferExpressionType TLhs, BufferExpressionType TRhs, typename TOperation>
+        requires (TLhs::DIMENSION_COUNT == TRhs::DIMENSION_COUNT) && std::invocable<TOperation, const typename TLhs::value_type&, const typename TRhs::value_type&>
+    class HEPH_API BufferBinaryExpression final : public BufferExpression<BufferBinaryExpression<TLhs, TRhs, TOperation>>
+    {
+    public:
+        /** @copybrief BufferViewExpression::value_type */
+        using value_type = std::remove_cvref_t<std::invoke_result_t<TOperation, const typename TLhs::value_type&, const typename TRhs::value_type&>>;
+        /** @copybrief BufferView::buffer_size_t */
+        using buffer_size_t = typename BufferIteratorTraits<value_type, TLhs::DIMENSION_COUNT>::buffer_size_t;
+
+        /** @brief Iterator that produces the results in row-major order. */
+        class const_iterator final
+        {
+        private:
+            /** @brief Iterator of the left operand. */
+            typename TLhs::const_iterator itLhs;
+            /** @brief Iterator of the right operand. */
+            typename TRhs::const_iterator itRhs;
+            /** @brief The operation. */
+            HEPH_NO_UNIQUE_ADDRESS TOperation operation;
+
+        public:
+            /**
+             * @copydoc constructor
+             *
+             * @param itLhs Iterator of the left operand.
+             * @param itRhs Iterator of the right operand.
+             * @param operation The operation.
+             */
+            const_iterator(const typename TLhs::const_iterator& itLhs, const typename TRhs::const_iterator& itRhs, const TOperation& operation)
+                : itLhs(itLhs), itRhs(itRhs), operation(operation)
+            {
+            }
+
+            /** Computes the result for the current element. */
+            HEPH_FORCE_INLINE value_type operator*() const
+            {
+                return this->operation(*this->itLhs, *this->itRhs);
+            }
+
+            /** Moves to the next element. */
+            HEPH_FORCE_INLINE const_iterator& operator++()
+            {
+                ++this->itLhs;
+                ++this->itRhs;
+                return *this;
+            }
+        };
+
+        /** @copybrief BufferViewExpression::DIMENSION_COUNT */
+        static constexpr size_t DIMENSION_COUNT = TLhs::DIMENSION_COUNT;
+        /** @copybrief BufferViewExpression::IS_SCALAR */
+        static constexpr bool IS_SCALAR = TLhs::IS_SCALAR && TRhs::IS_SCALAR;
+
+    private:
+        /** @brief Left operand. */
+        TLhs lhs;
+        /** @brief Right operand. */
+        TRhs rhs;
+        /** @brief The operation. */
+        HEPH_NO_UNIQUE_ADDRESS TOperation operation;
+
+    public:
+        /**
+         * @copydoc constructor
+         *
+         * @param lhs Left operand.
+         * @param rhs Right operand.
+         * @param operation The operation.
+         * @note Operands of different sizes are broadcast to a common size (see BufferView::BroadcastTo),
+         * e.g. a ``1 x C`` operand is repeated for each row of an ``R x C`` operand.
+         * @exception InvalidOperationException
+         */
+        BufferBinaryExpression(const TLhs& lhs, const TRhs& rhs, const TOperation& operation = TOperation())
+            : lhs(lhs), rhs(rhs), operation(operation)
+        {
+            static_assert(!IS_SCALAR, "At least one of the operands must have elements.");
+
+            if constexpr (!TLhs::IS_SCALAR && !TRhs::IS_SCALAR)
+            {
+                if (this->lhs.Size() != this->rhs.Size())
+                {
+                    buffer_size_t size;
+                    if (!BufferBinaryExpression::BroadcastSize(this->lhs.Size(), this->rhs.Size(), size))
+                    {
+                        HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Sizes of the buffers are not compatible for broadcasting.");
+                    }
+
+                    this->lhs = this->lhs.Broadcast(size);
+                    this->rhs = this->rhs.Broadcast(size);
+                }
+            }
+        }
+
+        /** Gets the left operand. */
+        HEPH_FORCE_INLINE const TLhs& Lhs() const
+        {
+            return this->lhs;
+        }
+
+        /** Gets the right operand. */
+        HEPH_FORCE_INLINE const TRhs& Rhs() const
+        {
+            return this->rhs;
+        }
+
+        /** Gets the number of elements in each dimension the result has. */
+        HEPH_FORCE_INLINE const buffer_size_t& Size() const
+        {
+            if constexpr (TLhs::IS_SCALAR) return this->rhs.Size();
+            else return this->lhs.Size();
+        }
+
+        /** Checks whether all operands can be read with a single row-major index. */
+        HEPH_FORCE_INLINE bool IsContiguous() const
+        {
+            return this->lhs.IsContiguous() && this->rhs.IsContiguous();
+        }
+
+        /** @copydoc BufferViewExpression::Element */
+        HEPH_FORCE_INLINE value_type Element(size_t index) const
+        {
+            return this->operation(this->lhs.Element(index), this->rhs.Element(index));
+        }
+
+        /** @copydoc BufferViewExpression::cbegin */
+        HEPH_FORCE_INLINE const_iterator cbegin() const
+        {
+            return const_iterator(this->lhs.cbegin(), this->rhs.cbegin(), this->operation);
+        }
+
+        /**
+         * Creates an expression that repeats the results to a larger size.
+         *
+         * @param size Number of elements in each dimension of the new expression.
+         * @exception InvalidArgumentException
+         */
+        BufferBinaryExpression Broadcast(const buffer_size_t& size) const
+        {
+            return BufferBinaryExpression(this->lhs.Broadcast(size), this->rhs.Broadcast(size), this->operation);
+        }
+
+        /** @copydoc BufferViewExpression::Aliases */
+        template<typename TView>
+        bool Aliases(const TView& dest) const
+        {
+            return this->lhs.Aliases(dest) || this->rhs.Aliases(dest);
+        }
+
+    private:
+        /**
+         * Computes the size two operands are broadcast to, each dimension must either be the same or 1 in one of them.
+         *
+         * @return false if the sizes are not compatible.
+         */
+        static bool BroadcastSize(const buffer_size_t& lhsSize, const buffer_size_t& rhsSize, buffer_size_t& result)
+        {
+            if constexpr (DIMENSION_COUNT == 1)
+            {
+                if (lhsSize != rhsSize && lhsSize != 1 && rhsSize != 1) return false;
+                result = (lhsSize == 1) ? rhsSize : lhsSize;
+            }
+            else
+            {
+                for (size_t i = 0; i < DIMENSION_COUNT; ++i)
+                {
+                    if (lhsSize[i] != rhsSize[i] && lhsSize[i] != 1 && rhsSize[i] != 1) return false;
+                    result[i] = (lhsSize[i] == 1) ? rhsSize[i] : lhsSize[i];
+                }
+            }
+            return true;
+        }
+    };
+
+    /** Gets the expression itself, allows expressions to be nested. */
+    template<BufferExpressionType TExpression>
+    HEPH_FORCE_INLINE const TExpression& MakeBufferExpression(const TExpression& expression)
+    {
+        return expression;
+    }
+
+    /** Wraps a view into a leaf expression. */
+    template<BufferElement TData, size_t NDimensions>
+    HEPH_FORCE_INLINE BufferViewExpression<std::remove_const_t<TData>, NDimensions> MakeBufferExpression(const BufferView<TData, NDimensions>& view)
+    {
+        return BufferViewExpression<std::remove_const_t<TData>, NDimensions>(view);
+    }
+
+    /**
+     * @brief Specifies that the type ``T`` can be wrapped into an expression via ``MakeBufferExpression``.
+     * Buffers opt in by providing an overload that can be found by argument-dependent lookup.
+     */
+    template<typename T>
+    concept BufferExpressionOperand = requires(const T & operand)
+    {
+        MakeBufferExpression(operand);
+        requires BufferExpressionType<std::remove_cvref_t<decltype(MakeBufferExpression(operand))>>;
+    };
+
+    /**
+     * @brief Helper for deducing the expression nodes the operands of an arithmetic operator are wrapped into,
+     * operands that are not \ref BufferExpressionOperand "expression operands" are treated as constants.
+     *
+     * @tparam TLhs Type of the left operand.
+     * @tparam TRhs Type of the right operand.
+     */
+    template<typename TLhs, typename TRhs>
+    struct BufferExpressionOperands final
+    {
+        HEPH_DISABLE_INSTANCE(BufferExpressionOperands);
+
+    private:
+        /** Wraps an operand into a node. */
+        template<typename T, size_t NDimensions>
+        static HEPH_FORCE_INLINE auto MakeNode(const T& operand)
+        {
+            if constexpr (BufferExpressionOperand<T>) return std::remove_cvref_t<decltype(MakeBufferExpression(operand))>(MakeBufferExpression(operand));
+            else return BufferScalarExpression<T, NDimensions>(operand);
+        }
+
+    public:
+        /** @brief Number of dimensions, taken from the first operand that has elements. */
+        static constexpr size_t DIMENSION_COUNT = decltype(MakeNode<std::conditional_t<BufferExpressionOperand<TLhs>, TLhs, TRhs>, 1>(std::declval<const std::conditional_t<BufferExpressionOperand<TLhs>, TLhs, TRhs>&>()))::DIMENSION_COUNT;
+
+        /** @brief Type of the node the left operand is wrapped into. */
+        using lhs_type = decltype(MakeNode<TLhs, DIMENSION_COUNT>(std::declval<const TLhs&>()));
+        /** @brief Type of the node the right operand is wrapped into. */
+        using rhs_type = decltype(MakeNode<TRhs, DIMENSION_COUNT>(std::declval<const TRhs&>()));
+
+        /**
+         * Creates an expression that applies an operation element-wise to the operands.
+         *
+         * @tparam TOperation Type of the operation.
+         * @param lhs Left operand.
+         * @param rhs Right operand.
+         * @exception InvalidOperationException
+         */
+        template<typename TOperation>
+        static HEPH_FORCE_INLINE BufferBinaryExpression<lhs_type, rhs_type, TOperation> Make(const TLhs& lhs, const TRhs& rhs)
+        {
+            return BufferBinaryExpression<lhs_type, rhs_type, TOperation>(MakeNode<TLhs, DIMENSION_COUNT>(lhs), MakeNode<TRhs, DIMENSION_COUNT>(rhs));
+        }
+    };
+
+    /** @brief Specifies that the type ``T`` is a view, views only take part in the arithmetic operators together with an expression or a buffer. */
+    template<typename T>
+    concept BufferViewType = requires(const T & view)
+    {
+        []<BufferElement TData, size_t NDimensions>(const BufferView<TData, NDimensions>&) {}(view);
+    };
+
+    /**
+     * @brief Specifies that ``TOperation`` can be applied element-wise to the operands.
+     * At least one operand must be an expression or a buffer, the other can also be a view or a constant.
+     *
+     * @tparam TOperation Type of the operation.
+     * @tparam TLhs Type of the left operand.
+     * @tparam TRhs Type of the right operand.
+     */
+    template<typename TOperation, typename TLhs, typename TRhs>
+    concept BufferExpressionOperation =
+        ((BufferExpressionOperand<TLhs> && !BufferViewType<TLhs>) || (BufferExpressionOperand<TRhs> && !BufferViewType<TRhs>)) &&
+        (BufferExpressionOperand<TLhs> || BufferElement<TLhs>) &&
+        (BufferExpressionOperand<TRhs> || BufferElement<TRhs>) &&
+        (BufferExpressionOperands<TLhs, TRhs>::lhs_type::DIMENSION_COUNT == BufferExpressionOperands<TLhs, TRhs>::rhs_type::DIMENSION_COUNT) &&
+        std::invocable<TOperation, const typename BufferExpressionOperands<TLhs, TRhs>::lhs_type::value_type&, const typename BufferExpressionOperands<TLhs, TRhs>::rhs_type::value_type&>;
+
+
+    /**
+     * Creates an expression that adds the elements of the operands, constants are added to all elements.
+     *
+     * @param lhs Left operand.
+     * @param rhs Right operand.
+     * @return Lazy expression, evaluated when assigned to a buffer.
+     * @exception InvalidOperationException
+     */
+    template<typename TLhs, typename TRhs>
+        requires BufferExpressionOperation<std::plus<>, TLhs, TRhs>
+    HEPH_FORCE_INLINE auto operator+(const TLhs& lhs, const TRhs& rhs)
+    {
+        return BufferExpressionOperands<TLhs, TRhs>::template Make<std::plus<>>(lhs, rhs);
+    }
+
+    /**
+     * Creates an expression that subtracts the elements of the right operand from the left operand, constants are subtracted from/to all elements.
+     *
+     * @param lhs Left operand.
+     * @param rhs Right operand.
+     * @return Lazy expression, evaluated when assigned to a buffer.
+     * @exception InvalidOperationException
+     */
+    template<typename TLhs, typename TRhs>
+        requires BufferExpressionOperation<std::minus<>, TLhs, TRhs>
+    HEPH_FORCE_INLINE auto operator-(const TLhs& lhs, const TRhs& rhs)
+    {
+        return BufferExpressionOperands<TLhs, TRhs>::template Make<std::minus<>>(lhs, rhs);
+    }
+
+    /**
+     * Creates an expression that multiplies the elements of the operands, constants multiply all elements.
+     *
+     * @param lhs Left operand.
+     * @param rhs Right operand.
+     * @return Lazy expression, evaluated when assigned to a buffer.
+     * @exception InvalidOperationException
+     */
+    template<typename TLhs, typename TRhs>
+        requires BufferExpressionOperation<std::multiplies<>, TLhs, TRhs>
+    HEPH_FORCE_INLINE auto operator*(const TLhs& lhs, const TRhs& rhs)
+    {
+        return BufferExpressionOperands<TLhs, TRhs>::template Make<std::multiplies<>>(lhs, rhs);
+    }
+
+    /**
+     * Creates an expression that divides the elements of the left operand by the right operand, constants divide/are divided by all elements.
+     *
+     * @param lhs Left operand.
+     * @param rhs Right operand.
+     * @return Lazy expression, evaluated when assigned to a buffer.
+     * @exception InvalidOperationException
+     */
+    template<typename TLhs, typename TRhs>
+        requires BufferExpressionOperation<std::divides<>, TLhs, TRhs>
+    HEPH_FORCE_INLINE auto operator/(const TLhs& lhs, const TRhs& rhs)
+    {
+        return BufferExpressionOperands<TLhs, TRhs>::template Make<std::divides<>>(lhs, rhs);
+    }
+}
+
+#endif
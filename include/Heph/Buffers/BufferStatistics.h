@@ -0,0 +1,119 @@
+#ifndef HEPH_BUFFER_STATISTICS_H
+#define HEPH_BUFFER_STATISTICS_H
+
+#include "Heph/Utils.h"
+#include <cmath>
+#include <limits>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Statistics of a set of elements, computed in a single pass.
+     *
+     * Statistics of disjoint sets can be combined with Merge, which allows computing them in chunks or in parallel.
+     * The mean and variance are updated with the method of Welford and Chan et al., which stays accurate when the mean is large compared to the deviation.
+     *
+     * @note NaN elements are skipped by min, max and absMax but propagate to the sums.
+     *
+     * @tparam TData Type of the elements.
+     */
+    template<typename TData>
+    struct BufferStatistics
+    {
+        /** @brief Number of elements. */
+        size_t count;
+        /** @brief Minimum element, or the largest finite value of ``TData`` if there are no elements. */
+        TData min;
+        /** @brief Maximum element, or the lowest finite value of ``TData`` if there are no elements. */
+        TData max;
+        /** @brief Maximum absolute value (peak), or the lowest finite value of ``TData`` if there are no elements. */
+        TData absMax;
+        /** @brief Sum of the elements. */
+        double sum;
+        /** @brief Mean of the elements. */
+        double mean;
+        /** @brief Sum of the squared differences from the mean. */
+        double sumOfSquaredDeviations;
+        /** @brief Sum of the squares of the elements. */
+        double sumOfSquares;
+
+        /** Creates the statistics of an empty set. */
+        constexpr BufferStatistics()
+            : count(0), min(std::numeric_limits<TData>::max()), max(std::numeric_limits<TData>::lowest()), absMax(std::numeric_limits<TData>::lowest()),
+            sum(0), mean(0), sumOfSquaredDeviations(0), sumOfSquares(0) {}
+
+        /** Calculates the population variance, or 0 if there are no elements. */
+        double Variance() const
+        {
+            return (this->count > 0) ? (this->sumOfSquaredDeviations / static_cast<double>(this->count)) : 0;
+        }
+
+        /** Calculates the population standard deviation. */
+        double StandardDeviation() const
+        {
+            return std::sqrt(this->Variance());
+        }
+
+        /** Calculates the root mean square, or 0 if there are no elements. */
+        double Rms() const
+        {
+            return (this->count > 0) ? std::sqrt(this->sumOfSquares / static_cast<double>(this->count)) : 0;
+        }
+
+        /**
+         * Adds an element to the statistics.
+         *
+         * @param element The element.
+         */
+        void Add(const TData& element)
+        {
+            const TData absElement = (element < TData(0)) ? -element : element;
+            if (element < this->min) this->min = element;
+            if (element > this->max) this->max = element;
+            if (absElement > this->absMax) this->absMax = absElement;
+
+            const double x = static_cast<double>(element);
+            const double delta = x - this->mean;
+
+            this->count++;
+            this->sum += x;
+            this->mean += delta / static_cast<double>(this->count);
+            this->sumOfSquaredDeviations += delta * (x - this->mean);
+            this->sumOfSquares += x * x;
+        }
+
+        /**
+         * Combines the statistics with the statistics of another, disjoint set of elements.
+         *
+         * @param rhs Statistics of the other set.
+         */
+        void Merge(const BufferStatistics& rhs)
+        {
+            if (rhs.count == 0) return;
+            if (this->count == 0)
+            {
+                *this = rhs;
+                return;
+            }
+
+            if (rhs.min < this->min) this->min = rhs.min;
+            if (rhs.max > this->max) this->max = rhs.max;
+            if (rhs.absMax > this->absMax) this->absMax = rhs.absMax;
+
+            const double lhsCount = static_cast<double>(this->count);
+            const double rhsCount = static_cast<double>(rhs.count);
+            const double totalCount = lhsCount + rhsCount;
+            const double delta = rhs.mean - this->mean;
+
+            this->count += rhs.count;
+            this->sum += rhs.sum;
+            this->mean += delta * (rhsCount / totalCount);
+            this->sumOfSquaredDeviations += rhs.sumOfSquaredDeviations + delta * delta * (lhsCount * rhsCount / totalCount);
+            this->sumOfSquares += rhs.sumOfSquares;
+        }
+    };
+}
+
+#endif
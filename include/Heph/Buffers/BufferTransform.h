@@ -0,0 +1,195 @@
+#ifndef HEPH_BUFFER_TRANSFORM_H
+#define HEPH_BUFFER_TRANSFORM_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/BufferView.h"
+#include "Heph/ExecutionPolicy.h"
+#include "Heph/Parallel.h"
+#include "Heph/Exceptions/InvalidArgumentException.h"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Specifies that the result of invoking ``TFunction`` with the elements of the sources can be assigned to an element of type ``TDestData``.
+     *
+     * @tparam TFunction Type of the function.
+     * @tparam TDestData Type of the destination elements.
+     * @tparam TSourceData Types of the source elements.
+     */
+    template<typename TFunction, typename TDestData, typename... TSourceData>
+    concept BufferTransformFunction = std::invocable<TFunction&, TSourceData&...> &&
+        std::is_assignable_v<TDestData&, std::invoke_result_t<TFunction&, TSourceData&...>>;
+
+    /**
+     * @brief Applies arbitrary element-wise functions to views.
+     *
+     * The elements are walked in contiguous chunks with plain indexed loops instead of the buffer iterators,
+     * hence functions that can be inlined are vectorized by the compiler for any layout whose innermost dimension is dense.
+     * Large views are split across threads with Parallel::For unless a sequenced execution policy is given.
+     *
+     * @note The function is invoked concurrently from multiple threads, and the order of the invocations is unspecified.
+     */
+    class HEPH_API BufferTransform final
+    {
+    public:
+        HEPH_DISABLE_INSTANCE(BufferTransform);
+
+        /** @brief Minimum number of elements each thread processes, smaller transforms run on the calling thread. */
+        static constexpr size_t PARALLEL_GRAIN_SIZE = 1uz << 16;
+
+        /**
+         * Invokes the function with the elements of the sources at each position and assigns the results to the destination,
+         * ``dest[i] = func(sources[i]...)``.
+         *
+         * @note Sources are broadcast to the size of the destination (see BufferView::BroadcastTo).
+         * The destination can also be a source as long as both have the same layout.
+         *
+         * @param dest View whose elements will be assigned.
+         * @param func Function that computes an element of the destination from the elements of the sources.
+         * @param sources Views whose elements are passed to the function.
+         * @exception InvalidArgumentException
+         */
+        template<BufferElement TDestData, size_t NDimensions, typename TFunction, BufferElement... TSourceData>
+            requires BufferTransformFunction<TFunction, TDestData, TSourceData...>
+        static void Transform(const BufferView<TDestData, NDimensions>& dest, TFunction func, const BufferView<TSourceData, NDimensions>&... sources)
+        {
+            BufferTransform::Transform(Execution::par, dest, func, sources...);
+        }
+
+        /**
+         * @copydoc Transform(const BufferView<TDestData, NDimensions>&, TFunction, const BufferView<TSourceData, NDimensions>&...)
+         *
+         * @param policy Specifies whether large views can be split across threads.
+         * With the sequenced policies the function is invoked in row-major order on the calling thread.
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TDestData, size_t NDimensions, typename TFunction, BufferElement... TSourceData>
+            requires BufferTransformFunction<TFunction, TDestData, TSourceData...>
+        static void Transform(const TPolicy& policy, const BufferView<TDestData, NDimensions>& dest, TFunction func, const BufferView<TSourceData, NDimensions>&... sources)
+        {
+            if (!(BufferView<TSourceData, NDimensions>::IsBroadcastable(sources.Size(), dest.Size()) && ...))
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Size of the sources cannot be broadcast to the size of the destination.");
+            }
+
+            if (dest.ElementCount() == 0) return;
+
+            BufferTransform::TransformImpl(policy, std::index_sequence_for<TSourceData...>(), dest, func, sources.BroadcastTo(dest.Size())...);
+        }
+
+        /**
+         * Replaces each element with the result of invoking the function with it, ``view[i] = func(view[i])``.
+         *
+         * @param view View whose elements will be replaced.
+         * @param func Function that computes the new value of an element.
+         */
+        template<BufferElement TData, size_t NDimensions, typename TFunction>
+            requires (!std::is_const_v<TData>) && BufferTransformFunction<TFunction, TData, const TData>
+        static void Apply(const BufferView<TData, NDimensions>& view, TFunction func)
+        {
+            BufferTransform::Apply(Execution::par, view, func);
+        }
+
+        /**
+         * @copydoc Apply(const BufferView<TData, NDimensions>&, TFunction)
+         *
+         * @param policy Specifies whether large views can be split across threads.
+         */
+        template<ExecutionPolicy TPolicy, BufferElement TData, size_t NDimensions, typename TFunction>
+            requires (!std::is_const_v<TData>) && BufferTransformFunction<TFunction, TData, const TData>
+        static void Apply(const TPolicy& policy, const BufferView<TData, NDimensions>& view, TFunction func)
+        {
+            BufferTransform::Transform(policy, view, func, BufferView<const TData, NDimensions>(view));
+        }
+
+    private:
+        /** Converts the size or the strides of a view to an array, which is a scalar for single dimensional views. */
+        template<size_t NDimensions, typename TSize>
+        static std::array<size_t, NDimensions> ToArray(const TSize& values)
+        {
+            if constexpr (NDimensions == 1) return { values };
+            else return values;
+        }
+
+        /** Walks the elements in rows of the innermost dimension, the sources are already broadcast to the size of the destination. */
+        template<ExecutionPolicy TPolicy, size_t... I, BufferElement TDestData, size_t NDimensions, typename TFunction, BufferElement... TSourceData>
+        static void TransformImpl(const TPolicy& policy, std::index_sequence<I...>, const BufferView<TDestData, NDimensions>& dest, TFunction& func, const BufferView<TSourceData, NDimensions>&... sources)
+        {
+            TDestData* const pDest = dest.Data();
+            const std::tuple<TSourceData* const...> pSources(sources.Data()...);
+            const size_t elementCount = dest.ElementCount();
+
+            if (dest.IsContiguous() && (sources.IsContiguous() && ...))
+            {
+                Parallel::For(policy, 0, elementCount, BufferTransform::PARALLEL_GRAIN_SIZE, [&](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            pDest[i] = func(std::get<I>(pSources)[i]...);
+                    });
+                return;
+            }
+
+            constexpr size_t lastDim = NDimensions - 1;
+            const std::array<size_t, NDimensions> size = BufferTransform::ToArray<NDimensions>(dest.Size());
+            const std::array<size_t, NDimensions> destStrides = BufferTransform::ToArray<NDimensions>(dest.Strides());
+            const std::array<std::array<size_t, NDimensions>, sizeof...(I)> sourceStrides = { BufferTransform::ToArray<NDimensions>(sources.Strides())... };
+
+            const size_t rowSize = size[lastDim];
+            const size_t rowCount = elementCount / rowSize;
+            const bool isDenseRow = destStrides[lastDim] == 1 && ((sourceStrides[I][lastDim] == 1) && ...);
+
+            Parallel::For(policy, 0, rowCount, std::max(BufferTransform::PARALLEL_GRAIN_SIZE / rowSize, 1uz), [&](size_t rowBegin, size_t rowEnd)
+                {
+                    std::array<size_t, NDimensions> index{};
+                    size_t destOffset = 0;
+                    // unused when there are no sources
+                    [[maybe_unused]] std::array<size_t, sizeof...(I)> sourceOffsets{};
+
+                    for (size_t dim = lastDim, row = rowBegin; dim-- > 0;)
+                    {
+                        index[dim] = row % size[dim];
+                        row /= size[dim];
+                        destOffset += index[dim] * destStrides[dim];
+                        ((sourceOffsets[I] += index[dim] * sourceStrides[I][dim]), ...);
+                    }
+
+                    for (size_t row = rowBegin; row < rowEnd; ++row)
+                    {
+                        TDestData* const pDestRow = pDest + destOffset;
+                        [[maybe_unused]] const std::tuple<TSourceData* const...> pSourceRows(std::get<I>(pSources) + sourceOffsets[I]...);
+
+                        if (isDenseRow)
+                        {
+                            for (size_t j = 0; j < rowSize; ++j)
+                                pDestRow[j] = func(std::get<I>(pSourceRows)[j]...);
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < rowSize; ++j)
+                                pDestRow[j * destStrides[lastDim]] = func(std::get<I>(pSourceRows)[j * sourceStrides[I][lastDim]]...);
+                        }
+
+                        for (size_t dim = lastDim; dim-- > 0;)
+                        {
+                            destOffset += destStrides[dim];
+                            ((sourceOffsets[I] += sourceStrides[I][dim]), ...);
+                            if (++index[dim] < size[dim]) break;
+
+                            destOffset -= destStrides[dim] * size[dim];
+                            ((sourceOffsets[I] -= sourceStrides[I][dim] * size[dim]), ...);
+                            index[dim] = 0;
+                        }
+                    }
+                });
+        }
+    };
+}
+
+#endif
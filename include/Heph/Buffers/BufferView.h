@@ -0,0 +1,508 @@
+#ifndef HEPH_BUFFER_VIEW_H
+#define HEPH_BUFFER_VIEW_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/Iterators/BufferIterator.h"
+#include "Heph/Buffers/Iterators/StridedBufferIterator.h"
+#include "Heph/Exceptions/InvalidArgumentException.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Non-owning view over the elements of a \ref buffers "Buffer" or any memory with a strided layout.
+     *
+     * @note The view does not extend the lifetime of the memory,
+     * it becomes invalid when the underlying buffer is released or reallocated.
+     *
+     * @tparam TData Type of the elements, add ``const`` for read-only views.
+     * @tparam NDimensions Number of dimensions.
+     */
+    template<BufferElement TData, size_t NDimensions = 1>
+        requires (NDimensions > 0)
+    class HEPH_API BufferView
+    {
+    public:
+        /** @brief Type of the iterator used by the view. */
+        using iterator = std::conditional_t<(NDimensions == 1), StridedBufferIterator<TData>, BufferIterator<TData, NDimensions>>;
+        /** @brief Type of the constant iterator used by the view. */
+        using const_iterator = std::conditional_t<(NDimensions == 1), StridedBufferIterator<const TData>, BufferIterator<const TData, NDimensions>>;
+        /** @copybrief BufferIteratorTraits::buffer_size_t */
+        using buffer_size_t = typename BufferIteratorTraits<TData, NDimensions>::buffer_size_t;
+        /** @copybrief BufferIteratorTraits::buffer_index_t */
+        using buffer_index_t = typename BufferIteratorTraits<TData, NDimensions>::buffer_index_t;
+
+        /** @copybrief BufferIteratorTraits::BUFFER_SIZE_ZERO */
+        static constexpr buffer_size_t BUFFER_SIZE_ZERO = BufferIteratorTraits<TData, NDimensions>::BUFFER_SIZE_ZERO;
+        /** @copybrief BufferIteratorTraits::BUFFER_INDEX_ZERO */
+        static constexpr buffer_index_t BUFFER_INDEX_ZERO = BufferIteratorTraits<TData, NDimensions>::BUFFER_INDEX_ZERO;
+
+    protected:
+        /** @brief Pointer to the first element of the view, or nullptr if the view is empty. */
+        TData* pData;
+        /** @brief Number of elements in each dimension the view has. */
+        buffer_size_t size;
+        /** @brief Number of elements to advance in one step for each dimension. */
+        buffer_size_t strides;
+
+    public:
+        /** @copydoc default_constructor */
+        BufferView()
+            : pData(nullptr), size(BUFFER_SIZE_ZERO), strides(BUFFER_SIZE_ZERO)
+        {
+        }
+
+        /**
+         * @copydoc constructor
+         *
+         * @param pData @copybrief pData
+         * @param size @copybrief size
+         * @param strides @copybrief strides
+         */
+        BufferView(TData* pData, const buffer_size_t& size, const buffer_size_t& strides)
+            : pData(pData), size(size), strides(strides)
+        {
+        }
+
+        /**
+         * Creates a read-only view from a mutable one.
+         *
+         * @param rhs Mutable view.
+         */
+        template<BufferElement TRhsData>
+            requires (std::is_const_v<TData> && std::is_same_v<const TRhsData, TData>)
+        BufferView(const BufferView<TRhsData, NDimensions>& rhs)
+            : pData(rhs.Data()), size(rhs.Size()), strides(rhs.Strides())
+        {
+        }
+
+        /**
+         * Gets the element at the provided index.
+         *
+         * @param indices Indices of the element.
+         * @return Reference to the element.
+         */
+        TData& operator[](auto... indices) const
+        {
+            static_assert(sizeof...(indices) > 0 && sizeof...(indices) <= NDimensions, "Invalid number of indices parameters.");
+            static_assert((std::is_convertible_v<decltype(indices), index_t> && ...), "Invalid type for indices parameters, must be convertible to index_t.");
+
+            const buffer_index_t indicesArray = { static_cast<index_t>(indices)... };
+            return iterator::template Get<false>(this->pData, this->size, this->strides, indicesArray);
+        }
+
+        /** @copydoc operator[] */
+        TData& operator[](const buffer_index_t& indices) const
+        {
+            return iterator::template Get<false>(this->pData, this->size, this->strides, indices);
+        }
+
+        /**
+         * Compares the elements of two views.
+         *
+         * @param rhs View to compare.
+         * @return ``true`` if elements are equal, otherwise ``false``.
+         */
+        bool operator==(const BufferView& rhs) const
+        {
+            return (this->IsEmpty() && rhs.IsEmpty()) || (this->size == rhs.size && std::equal(this->begin(), this->end(), rhs.begin()));
+        }
+
+        /**
+         * @copydoc operator[]
+         *
+         * @exception InvalidArgumentException
+         */
+        TData& At(auto... indices) const
+        {
+            static_assert(sizeof...(indices) > 0 && sizeof...(indices) <= NDimensions, "Invalid number of indices parameters.");
+            static_assert((std::is_convertible_v<decltype(indices), index_t> && ...), "Invalid type for indices parameters, must be convertible to index_t.");
+
+            const buffer_index_t indicesArray = { static_cast<index_t>(indices)... };
+            return iterator::template Get<true>(this->pData, this->size, this->strides, indicesArray);
+        }
+
+        /** @copydoc At */
+        TData& At(const buffer_index_t& indices) const
+        {
+            return iterator::template Get<true>(this->pData, this->size, this->strides, indices);
+        }
+
+        /**
+         * Checks whether the view is empty.
+         *
+         * @return true if the view is empty, otherwise false.
+         */
+        bool IsEmpty() const
+        {
+            return (this->ElementCount() == 0) || (this->pData == nullptr);
+        }
+
+        /** Gets the pointer to the first element. */
+        TData* Data() const
+        {
+            return this->pData;
+        }
+
+        /** Gets the number of elements in each dimension the view has. */
+        const buffer_size_t& Size() const
+        {
+            return this->size;
+        }
+
+        /**
+         * Gets the number of elements of the dimension.
+         *
+         * @param dim 0-based dimension.
+         * @exception InvalidArgumentException
+         */
+        size_t Size(size_t dim) const
+        {
+            if (dim >= NDimensions)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Invalid dimension.");
+            }
+
+            if constexpr (NDimensions == 1) return this->size;
+            else return this->size[dim];
+        }
+
+        /** Gets the number of elements to advance in one step for each dimension. */
+        const buffer_size_t& Strides() const
+        {
+            return this->strides;
+        }
+
+        /** Gets the total number of elements. */
+        size_t ElementCount() const
+        {
+            if constexpr (NDimensions == 1) return this->size;
+            else return std::accumulate(this->size.begin(), this->size.end(), 1uz, std::multiplies<size_t>());
+        }
+
+        /**
+         * Checks whether the elements are laid out in row-major order without gaps.
+         *
+         * @return true if the strides match the ones calculated from the size, otherwise false.
+         */
+        bool IsContiguous() const
+        {
+            if constexpr (NDimensions == 1) return this->size <= 1 || this->strides == 1;
+            else
+            {
+                size_t expectedStride = 1;
+                for (index_t i = NDimensions - 1; i >= 0; --i)
+                {
+                    if (this->size[i] != 1 && this->strides[i] != expectedStride) return false;
+                    expectedStride *= this->size[i];
+                }
+                return true;
+            }
+        }
+
+        /**
+         * Checks whether the memory the view spans, from its first to its last element, intersects the memory another view spans.
+         *
+         * @note The gaps between strided elements are part of the span, hence interleaved views are reported as overlapping.
+         *
+         * @param rhs The other view.
+         */
+        template<BufferElement TRhsData>
+            requires std::same_as<std::remove_const_t<TRhsData>, std::remove_const_t<TData>>
+        bool Overlaps(const BufferView<TRhsData, NDimensions>& rhs) const
+        {
+            if (this->IsEmpty() || rhs.IsEmpty()) return false;
+
+            const TData* const pEnd = this->pData + BufferView::SpanLength(this->size, this->strides);
+            const TRhsData* const pRhsEnd = rhs.Data() + BufferView::SpanLength(rhs.Size(), rhs.Strides());
+            return std::less<const void*>()(rhs.Data(), pEnd) && std::less<const void*>()(this->pData, pRhsEnd);
+        }
+
+        /**
+         * Copies the elements to contiguous memory in row-major order.
+         *
+         * @note If the view is densest along a dimension other than the last one (e.g. after an in-place transpose),
+         * the elements are copied in tiles so that both reads and writes stay in cache.
+         *
+         * @param pDest Pointer to the memory that can hold at least ElementCount() elements.
+         */
+        void CopyTo(std::remove_const_t<TData>* pDest) const
+        {
+            if (this->IsEmpty()) return;
+
+            if (this->IsContiguous())
+            {
+                (void)std::copy(this->pData, this->pData + this->ElementCount(), pDest);
+                return;
+            }
+
+            if constexpr (NDimensions == 1)
+            {
+                (void)std::copy(this->begin(), this->end(), pDest);
+            }
+            else
+            {
+                constexpr size_t lastDim = NDimensions - 1;
+
+                // the dimension the source is densest along
+                size_t fastDim = lastDim;
+                for (size_t i = 0; i < lastDim; ++i)
+                {
+                    if (this->size[i] > 1 && (this->size[fastDim] <= 1 || this->strides[i] < this->strides[fastDim]))
+                        fastDim = i;
+                }
+
+                buffer_size_t destStrides;
+                destStrides[lastDim] = 1;
+                for (index_t i = lastDim - 1; i >= 0; --i)
+                    destStrides[i] = destStrides[i + 1] * this->size[i + 1];
+
+                const size_t innerElementCount = (fastDim == lastDim) ? this->size[lastDim] : (this->size[fastDim] * this->size[lastDim]);
+                const size_t outerCount = this->ElementCount() / innerElementCount;
+
+                buffer_size_t outerIndices = BUFFER_SIZE_ZERO;
+                index_t srcOffset = 0;
+                index_t destOffset = 0;
+                for (size_t n = 0; n < outerCount; ++n)
+                {
+                    if (fastDim == lastDim)
+                    {
+                        BufferView::CopyRow(this->pData + srcOffset, this->strides[lastDim], pDest + destOffset, this->size[lastDim]);
+                    }
+                    else
+                    {
+                        BufferView::CopyBlocked(
+                            this->pData + srcOffset, this->strides[fastDim], this->strides[lastDim],
+                            pDest + destOffset, destStrides[fastDim],
+                            this->size[fastDim], this->size[lastDim]
+                        );
+                    }
+
+                    // move to the next entry of the remaining dimensions
+                    for (index_t d = lastDim - 1; d >= 0; --d)
+                    {
+                        if (d == static_cast<index_t>(fastDim)) continue;
+
+                        outerIndices[d]++;
+                        srcOffset += this->strides[d];
+                        destOffset += destStrides[d];
+                        if (outerIndices[d] < this->size[d]) break;
+
+                        srcOffset -= this->size[d] * this->strides[d];
+                        destOffset -= this->size[d] * destStrides[d];
+                        outerIndices[d] = 0;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Creates a view over a section of the provided dimension.
+         *
+         * @param dim 0-based dimension to slice.
+         * @param start Index of the first entry in the dimension.
+         * @param count Number of entries the new view will have in the dimension.
+         * @param step Number of entries to advance between two consecutive entries of the new view.
+         * @return New view that shares the memory with the current one.
+         * @exception InvalidArgumentException
+         */
+        BufferView Slice(size_t dim, size_t start, size_t count, size_t step = 1) const
+        {
+            if (dim >= NDimensions)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Invalid dimension.");
+            }
+
+            if (step == 0)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Step cannot be 0.");
+            }
+
+            const size_t dimSize = this->Size(dim);
+            if (start > dimSize || (count > 0 && (start + (count - 1) * step) >= dimSize))
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Index out of bounds.");
+            }
+
+            BufferView result = *this;
+            if constexpr (NDimensions == 1)
+            {
+                result.pData += start * this->strides;
+                result.size = count;
+                result.strides *= step;
+            }
+            else
+            {
+                result.pData += start * this->strides[dim];
+                result.size[dim] = count;
+                result.strides[dim] *= step;
+            }
+
+            return result;
+        }
+
+        /**
+         * Checks whether a view with the provided size can be broadcast to the target size.
+         * Dimensions are aligned from the last one, each must either be the same as the target or 1.
+         *
+         * @tparam NTargetDimensions Number of dimensions of the target, must not be less than the current one.
+         * @param size Number of elements in each dimension of the view.
+         * @param targetSize Number of elements in each dimension of the target.
+         */
+        template<size_t NTargetDimensions = NDimensions>
+            requires (NTargetDimensions >= NDimensions)
+        static bool IsBroadcastable(const buffer_size_t& size, const typename BufferIteratorTraits<TData, NTargetDimensions>::buffer_size_t& targetSize)
+        {
+            if constexpr (NTargetDimensions == 1)
+            {
+                return size == targetSize || size == 1;
+            }
+            else
+            {
+                constexpr size_t offset = NTargetDimensions - NDimensions;
+                for (size_t i = 0; i < NDimensions; ++i)
+                {
+                    const size_t dimSize = BufferView::DimensionSize(size, i);
+                    if (dimSize != targetSize[i + offset] && dimSize != 1) return false;
+                }
+                return true;
+            }
+        }
+
+        /**
+         * Creates a view that repeats the elements to a larger size without copying them.
+         * Dimensions are aligned from the last one, dimensions of size 1 and the leading dimensions the view does not have
+         * are repeated by stepping 0 elements in them.
+         *
+         * @note Writing through the new view writes the repeated elements more than once.
+         *
+         * @tparam NTargetDimensions Number of dimensions of the new view, must not be less than the current one.
+         * @param targetSize Number of elements in each dimension of the new view.
+         * @return New view that shares the memory with the current one.
+         * @exception InvalidArgumentException
+         */
+        template<size_t NTargetDimensions = NDimensions>
+            requires (NTargetDimensions >= NDimensions)
+        BufferView<TData, NTargetDimensions> BroadcastTo(const typename BufferIteratorTraits<TData, NTargetDimensions>::buffer_size_t& targetSize) const
+        {
+            if (!BufferView::IsBroadcastable<NTargetDimensions>(this->size, targetSize))
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Size cannot be broadcast to the target size.");
+            }
+
+            typename BufferIteratorTraits<TData, NTargetDimensions>::buffer_size_t targetStrides{};
+            if constexpr (NTargetDimensions == 1)
+            {
+                targetStrides = (this->size == targetSize) ? this->strides : 0;
+            }
+            else
+            {
+                constexpr size_t offset = NTargetDimensions - NDimensions;
+                for (size_t i = 0; i < NDimensions; ++i)
+                {
+                    if (BufferView::DimensionSize(this->size, i) == targetSize[i + offset])
+                        targetStrides[i + offset] = BufferView::DimensionSize(this->strides, i);
+                }
+            }
+
+            return BufferView<TData, NTargetDimensions>(this->pData, targetSize, targetStrides);
+        }
+
+        /** Returns an iterator to the beginning. */
+        iterator begin() const
+        {
+            return iterator(this->pData, this->size, this->strides, BUFFER_INDEX_ZERO);
+        }
+
+        /** Returns a constant iterator to the beginning. */
+        const_iterator cbegin() const
+        {
+            return const_iterator(this->pData, this->size, this->strides, BUFFER_INDEX_ZERO);
+        }
+
+        /** Returns an iterator to the end. */
+        iterator end() const
+        {
+            const buffer_index_t indices = { static_cast<index_t>(this->Size(0)) };
+            return iterator(this->pData, this->size, this->strides, indices);
+        }
+
+        /** Returns a constant iterator to the end. */
+        const_iterator cend() const
+        {
+            const buffer_index_t indices = { static_cast<index_t>(this->Size(0)) };
+            return const_iterator(this->pData, this->size, this->strides, indices);
+        }
+
+    private:
+        /** Gets the value of a dimension from a size or strides array, which is a scalar for single dimensional views. */
+        static size_t DimensionSize(const buffer_size_t& values, size_t dim)
+        {
+            if constexpr (NDimensions == 1) return values;
+            else return values[dim];
+        }
+
+        /** Gets the number of elements from the first element to one past the last element in memory, the view must not be empty. */
+        static size_t SpanLength(const buffer_size_t& size, const buffer_size_t& strides)
+        {
+            size_t length = 1;
+            for (size_t i = 0; i < NDimensions; ++i)
+                length += (BufferView::DimensionSize(size, i) - 1) * BufferView::DimensionSize(strides, i);
+            return length;
+        }
+
+        /** @brief Number of elements in each dimension of the tiles used by CopyBlocked. */
+        static constexpr size_t COPY_BLOCK_SIZE = std::max<size_t>(8, 256 / sizeof(TData));
+
+        /**
+         * Copies a strided row to contiguous memory.
+         *
+         * @param pSrc Pointer to the first element of the row.
+         * @param srcStride Number of elements between two consecutive elements of the row.
+         * @param pDest Pointer to the destination.
+         * @param count Number of elements in the row.
+         */
+        static void CopyRow(const TData* pSrc, index_t srcStride, std::remove_const_t<TData>* pDest, size_t count)
+        {
+            for (size_t j = 0; j < count; ++j)
+                pDest[j] = pSrc[j * srcStride];
+        }
+
+        /**
+         * Copies a 2D block whose source is densest along the rows and destination along the columns, tile by tile.
+         *
+         * @param pSrc Pointer to the first element of the block.
+         * @param srcRowStride Source stride of the first dimension.
+         * @param srcColStride Source stride of the second dimension.
+         * @param pDest Pointer to the destination.
+         * @param destRowStride Destination stride of the first dimension, the second is 1.
+         * @param rowCount Number of elements in the first dimension.
+         * @param colCount Number of elements in the second dimension.
+         */
+        static void CopyBlocked(const TData* pSrc, index_t srcRowStride, index_t srcColStride, std::remove_const_t<TData>* pDest, index_t destRowStride, size_t rowCount, size_t colCount)
+        {
+            for (size_t i0 = 0; i0 < rowCount; i0 += COPY_BLOCK_SIZE)
+            {
+                const size_t iEnd = std::min(i0 + COPY_BLOCK_SIZE, rowCount);
+                for (size_t j0 = 0; j0 < colCount; j0 += COPY_BLOCK_SIZE)
+                {
+                    const size_t jEnd = std::min(j0 + COPY_BLOCK_SIZE, colCount);
+                    for (size_t i = i0; i < iEnd; ++i)
+                    {
+                        const TData* pSrcRow = pSrc + i * srcRowStride;
+                        std::remove_const_t<TData>* pDestRow = pDest + i * destRowStride;
+                        for (size_t j = j0; j < jEnd; ++j)
+                            pDestRow[j] = pSrcRow[j * srcColStride];
+                    }
+                }
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,528 @@
+#ifndef HEPH_CIRCULAR_BUFFER_H
+#define HEPH_CIRCULAR_BUFFER_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/Buffer.h"
+#include "Heph/Buffers/Iterators/CircularBufferIterator.h"
+#include "Heph/Enum.h"
+#include "Heph/Exceptions/InvalidArgumentException.h"
+#include "Heph/Exceptions/InvalidOperationException.h"
+#include <algorithm>
+
+/** @file */
+
+namespace Heph
+{
+    /** @brief Specifies what happens when entries are pushed to a full Heph::CircularBuffer. */
+    enum CircularBufferOverflowMode
+    {
+        /** @brief Specifies that the entries that do not fit are not pushed. */
+        Reject,
+        /** @brief Specifies that the oldest entries are removed to make room for the new ones. */
+        OverwriteOldest
+    };
+
+    /**
+     * @brief Fixed-capacity FIFO queue of top-level entries with constant time push and pop.
+     * Entries are stored in a ring, so pushing and popping never moves the stored entries.
+     *
+     * @note For multidimensional buffers, the first dimension is the capacity and the remaining dimensions are the shape of each entry.
+     *
+     * @tparam TData Type of the elements stored in buffer.
+     * @tparam NDimensions Number of dimensions.
+     * @tparam TAllocator Type of the allocator.
+     */
+    template <
+        BufferElement TData,
+        size_t NDimensions = 1,
+        template<typename> typename TAllocator = BufferAllocator
+    >
+        requires (NDimensions > 0)
+    class HEPH_API CircularBuffer
+    {
+    public:
+        /** @brief Type of the buffer that stores the entries. */
+        using storage_type = Buffer<TData, NDimensions, CircularBufferIterator, TAllocator>;
+
+        /** @copybrief Buffer::iterator */
+        using iterator = typename storage_type::iterator;
+        /** @copybrief Buffer::const_iterator */
+        using const_iterator = typename storage_type::const_iterator;
+        /** @copybrief Buffer::buffer_size_t */
+        using buffer_size_t = typename storage_type::buffer_size_t;
+        /** @copybrief Buffer::buffer_index_t */
+        using buffer_index_t = typename storage_type::buffer_index_t;
+        /** @copybrief Buffer::allocator_type */
+        using allocator_type = typename storage_type::allocator_type;
+        /** @copybrief Buffer::view_type */
+        using view_type = typename storage_type::view_type;
+        /** @copybrief Buffer::const_view_type */
+        using const_view_type = typename storage_type::const_view_type;
+
+    protected:
+        /** @brief Memory of the ring, its first dimension is the capacity. */
+        storage_type storage;
+        /** @brief Index of the oldest entry in the ring. */
+        size_t head;
+        /** @brief Number of entries in the ring. */
+        size_t count;
+        /** @brief Specifies what happens when pushing to a full ring. */
+        Enum<CircularBufferOverflowMode> overflowMode;
+
+    public:
+        /**
+         * @copydoc constructor
+         *
+         * @param size Number of entries the buffer can hold, followed by the size of each entry.
+         * @exception InsufficientMemoryException
+         */
+        explicit CircularBuffer(auto... size)
+            requires ((std::is_convertible_v<decltype(size), size_t> && !std::is_enum_v<decltype(size)>) && ...)
+        : storage(std::forward<decltype(size)>(size)...), head(0), count(0), overflowMode(CircularBufferOverflowMode::Reject)
+        {
+        }
+
+        /**
+         * @copydoc constructor
+         *
+         * @param size Number of entries the buffer can hold, followed by the size of each entry.
+         * @param overflowMode Specifies what happens when pushing to a full buffer.
+         * @param allocator @copybrief Buffer::allocator
+         * @exception InsufficientMemoryException
+         */
+        explicit CircularBuffer(const buffer_size_t& size, Enum<CircularBufferOverflowMode> overflowMode = CircularBufferOverflowMode::Reject, const allocator_type& allocator = allocator_type())
+            : storage(size, allocator), head(0), count(0), overflowMode(overflowMode)
+        {
+        }
+
+        /** @copydoc copy_constructor */
+        CircularBuffer(const CircularBuffer& rhs) = default;
+
+        /** @copydoc move_constructor */
+        CircularBuffer(CircularBuffer&& rhs) noexcept
+            : storage(std::move(rhs.storage)), head(rhs.head), count(rhs.count), overflowMode(rhs.overflowMode)
+        {
+            rhs.head = 0;
+            rhs.count = 0;
+        }
+
+        /** @copydoc destructor */
+        virtual ~CircularBuffer() = default;
+
+        /**
+         * @copydoc copy_constructor
+         *
+         * @return Reference to current instance.
+         */
+        CircularBuffer& operator=(const CircularBuffer& rhs) = default;
+
+        /**
+         * @copydoc move_constructor
+         *
+         * @return Reference to current instance.
+         */
+        CircularBuffer& operator=(CircularBuffer&& rhs) noexcept
+        {
+            if (&rhs != this)
+            {
+                this->storage = std::move(rhs.storage);
+                this->head = rhs.head;
+                this->count = rhs.count;
+                this->overflowMode = rhs.overflowMode;
+
+                rhs.head = 0;
+                rhs.count = 0;
+            }
+
+            return *this;
+        }
+
+        /**
+         * Gets the element at the provided indices, the first index is relative to the oldest entry.
+         *
+         * @note Indices are not validated and wrap around the capacity.
+         */
+        TData& operator[](auto... indices)
+        {
+            return this->storage[this->ToStorageIndices(indices...)];
+        }
+
+        /** @copydoc operator[] */
+        const TData& operator[](auto... indices) const
+        {
+            return this->storage[this->ToStorageIndices(indices...)];
+        }
+
+        /**
+         * Gets the element at the provided indices, the first index is relative to the oldest entry.
+         *
+         * @exception InvalidArgumentException
+         */
+        TData& At(auto... indices)
+        {
+            return this->storage[this->ToStorageIndices<true>(indices...)];
+        }
+
+        /** @copydoc At */
+        const TData& At(auto... indices) const
+        {
+            return this->storage[this->ToStorageIndices<true>(indices...)];
+        }
+
+        /** Gets the number of entries the buffer can hold. */
+        size_t Capacity() const
+        {
+            return this->storage.Size(0);
+        }
+
+        /** Gets the number of entries in the buffer. */
+        size_t Count() const
+        {
+            return this->count;
+        }
+
+        /** Gets the number of entries that can be pushed before the buffer is full. */
+        size_t Available() const
+        {
+            return this->Capacity() - this->count;
+        }
+
+        /** Checks whether the buffer has no entries. */
+        bool IsEmpty() const
+        {
+            return this->count == 0;
+        }
+
+        /** Checks whether the buffer has no room for more entries. */
+        bool IsFull() const
+        {
+            return this->count == this->Capacity();
+        }
+
+        /**
+         * Gets the size of the buffer, the first dimension is the number of entries.
+         *
+         * @note Unlike Buffer::Size, returns by value since the entry count is not stored in the size array.
+         */
+        buffer_size_t Size() const
+        {
+            buffer_size_t result = this->storage.Size();
+            if constexpr (NDimensions == 1) result = this->count;
+            else result[0] = this->count;
+            return result;
+        }
+
+        /** Gets the number of elements each entry has. */
+        size_t EntryElementCount() const
+        {
+            if constexpr (NDimensions == 1) return 1;
+            else return std::accumulate(this->storage.Size().begin() + 1, this->storage.Size().end(), 1uz, std::multiplies<size_t>());
+        }
+
+        /** Gets what happens when pushing to a full buffer. */
+        Enum<CircularBufferOverflowMode> OverflowMode() const
+        {
+            return this->overflowMode;
+        }
+
+        /**
+         * Sets what happens when pushing to a full buffer.
+         *
+         * @param overflowMode The new mode.
+         */
+        void SetOverflowMode(Enum<CircularBufferOverflowMode> overflowMode)
+        {
+            this->overflowMode = overflowMode;
+        }
+
+        /** Gets the allocator. */
+        const allocator_type& Allocator() const
+        {
+            return this->storage.Allocator();
+        }
+
+        /**
+         * Appends the entries after the newest entry.
+         *
+         * @note If the buffer does not have enough room, either the entries that do not fit are not pushed,
+         * or the oldest entries are removed, depending on the overflow mode.
+         *
+         * @param entries The entries to push, must have the same entry size as the buffer.
+         * @return Number of entries pushed.
+         * @exception InvalidArgumentException
+         */
+        size_t Push(const const_view_type& entries)
+        {
+            this->ValidateEntrySize(entries);
+
+            const size_t capacity = this->Capacity();
+            size_t n = entries.Size(0);
+            if (n == 0 || capacity == 0) return 0;
+
+            const_view_type src = entries;
+            if (n > this->Available())
+            {
+                if (this->overflowMode == CircularBufferOverflowMode::OverwriteOldest)
+                {
+                    if (n >= capacity)
+                    {
+                        // only the newest entries survive
+                        src = entries.Slice(0, n - capacity, capacity);
+                        this->head = 0;
+                        this->count = 0;
+                        n = capacity;
+                    }
+                    else
+                    {
+                        this->Discard(n - this->Available());
+                    }
+                }
+                else
+                {
+                    n = this->Available();
+                    if (n == 0) return 0;
+                    src = entries.Slice(0, 0, n);
+                }
+            }
+
+            const size_t tail = (this->head + this->count) % capacity;
+            const size_t firstCount = std::min(n, capacity - tail);
+
+            src.Slice(0, 0, firstCount).CopyTo(this->EntryPointer(tail));
+            src.Slice(0, firstCount, n - firstCount).CopyTo(this->EntryPointer(0));
+
+            this->count += n;
+            return n;
+        }
+
+        /**
+         * Appends an element after the newest element.
+         *
+         * @param element The element to push.
+         * @return ``true`` if the element is pushed.
+         */
+        bool Push(const TData& element) requires (NDimensions == 1)
+        {
+            return this->Push(const_view_type(&element, 1, 1)) == 1;
+        }
+
+        /**
+         * Copies the oldest entries without removing them.
+         *
+         * @param dest The view to copy the entries to, must have the same entry size as the buffer.
+         * @param offset Number of entries to skip, starting from the oldest one.
+         * @return Number of entries copied.
+         * @exception InvalidArgumentException
+         */
+        size_t Peek(const view_type& dest, size_t offset = 0) const
+        {
+            this->ValidateEntrySize(dest);
+
+            if (offset >= this->count) return 0;
+
+            const size_t capacity = this->Capacity();
+            const size_t n = std::min(dest.Size(0), this->count - offset);
+            const size_t start = (this->head + offset) % capacity;
+            const size_t firstCount = std::min(n, capacity - start);
+
+            const const_view_type storageView = this->storage.View();
+            CircularBuffer::Copy(storageView.Slice(0, start, firstCount), dest.Slice(0, 0, firstCount));
+            CircularBuffer::Copy(storageView.Slice(0, 0, n - firstCount), dest.Slice(0, firstCount, n - firstCount));
+
+            return n;
+        }
+
+        /**
+         * Gets the oldest element without removing it.
+         *
+         * @exception InvalidOperationException
+         */
+        const TData& Peek() const requires (NDimensions == 1)
+        {
+            if (this->IsEmpty())
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Buffer is empty.");
+            }
+
+            return this->storage[this->head];
+        }
+
+        /**
+         * Removes the oldest entries and copies them.
+         *
+         * @param dest The view to copy the entries to, must have the same entry size as the buffer.
+         * @return Number of entries removed.
+         * @exception InvalidArgumentException
+         */
+        size_t Pop(const view_type& dest)
+        {
+            const size_t n = this->Peek(dest);
+            this->Discard(n);
+            return n;
+        }
+
+        /**
+         * Removes the oldest element and returns it.
+         *
+         * @exception InvalidOperationException
+         */
+        TData Pop() requires (NDimensions == 1)
+        {
+            const TData result = this->Peek();
+            this->Discard(1);
+            return result;
+        }
+
+        /**
+         * Removes the oldest entries without copying them.
+         *
+         * @param n Number of entries to remove.
+         * @return Number of entries removed.
+         */
+        size_t Discard(size_t n)
+        {
+            n = std::min(n, this->count);
+            if (n > 0)
+            {
+                this->head = (this->head + n) % this->Capacity();
+                this->count -= n;
+            }
+            return n;
+        }
+
+        /** Removes all entries, the memory is kept. */
+        void Clear()
+        {
+            this->head = 0;
+            this->count = 0;
+        }
+
+        /** Returns an iterator to the oldest element. */
+        iterator begin()
+        {
+            return iterator(this->storage.View().Data(), this->storage.Size(), this->storage.Strides(), this->HeadIndices(0));
+        }
+
+        /** @copydoc begin */
+        const_iterator begin() const
+        {
+            return this->cbegin();
+        }
+
+        /** @copydoc begin */
+        const_iterator cbegin() const
+        {
+            return const_iterator(this->storage.View().Data(), this->storage.Size(), this->storage.Strides(), this->HeadIndices(0));
+        }
+
+        /** Returns an iterator past the newest element. */
+        iterator end()
+        {
+            return iterator(this->storage.View().Data(), this->storage.Size(), this->storage.Strides(), this->HeadIndices(this->count));
+        }
+
+        /** @copydoc end */
+        const_iterator end() const
+        {
+            return this->cend();
+        }
+
+        /** @copydoc end */
+        const_iterator cend() const
+        {
+            return const_iterator(this->storage.View().Data(), this->storage.Size(), this->storage.Strides(), this->HeadIndices(this->count));
+        }
+
+    protected:
+        /**
+         * Gets a pointer to the first element of an entry in the storage.
+         *
+         * @param index Index of the entry in the storage.
+         */
+        TData* EntryPointer(size_t index)
+        {
+            return this->storage.View().Data() + index * this->EntryElementCount();
+        }
+
+        /**
+         * Gets the storage indices of the first element of an entry.
+         *
+         * @param index Index of the entry relative to the oldest entry.
+         */
+        buffer_index_t HeadIndices(size_t index) const
+        {
+            buffer_index_t result = storage_type::BUFFER_INDEX_ZERO;
+            if constexpr (NDimensions == 1) result = this->head + index;
+            else result[0] = this->head + index;
+            return result;
+        }
+
+        /**
+         * Converts indices relative to the oldest entry to storage indices.
+         *
+         * @tparam CheckErrors Determines whether to validate indices.
+         */
+        template<bool CheckErrors = false>
+        buffer_index_t ToStorageIndices(auto... indices) const
+        {
+            static_assert(sizeof...(indices) == NDimensions, "Invalid number of indices parameters.");
+            static_assert((std::is_convertible_v<decltype(indices), index_t> && ...), "Invalid type for indices parameters, must be convertible to index_t.");
+
+            buffer_index_t result = { static_cast<index_t>(indices)... };
+            index_t& entryIndex = [&result]() -> index_t& { if constexpr (NDimensions == 1) return result; else return result[0]; }();
+
+            if constexpr (CheckErrors)
+            {
+                if (entryIndex < 0 || entryIndex >= static_cast<index_t>(this->count))
+                {
+                    HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Index out of bounds.");
+                }
+
+                if constexpr (NDimensions > 1)
+                {
+                    for (size_t i = 1; i < NDimensions; ++i)
+                    {
+                        if (result[i] < 0 || result[i] >= static_cast<index_t>(this->storage.Size(i)))
+                        {
+                            HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Index out of bounds.");
+                        }
+                    }
+                }
+            }
+
+            entryIndex += this->head;
+            return result;
+        }
+
+        /**
+         * Validates that the view has the same entry size as the buffer.
+         *
+         * @exception InvalidArgumentException
+         */
+        template<typename TView>
+        void ValidateEntrySize(const TView& view) const
+        {
+            if constexpr (NDimensions > 1)
+            {
+                if (!std::equal(view.Size().begin() + 1, view.Size().end(), this->storage.Size().begin() + 1))
+                {
+                    HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Entry sizes must match.");
+                }
+            }
+        }
+
+        /**
+         * Copies the elements of a view to another view of the same size.
+         *
+         * @param src The view to copy from.
+         * @param dest The view to copy to.
+         */
+        static void Copy(const const_view_type& src, const view_type& dest)
+        {
+            if (dest.IsContiguous()) src.CopyTo(dest.Data());
+            else (void)std::copy(src.begin(), src.end(), dest.begin());
+        }
+    };
+}
+
+#endif
@@ -56,8 +56,16 @@ namespace Heph
         const buffer_size_t* pStrides;
         /** @brief Current position of the iterator. */
         buffer_index_t indices;
+        /** @brief Offset of the current element from ``pData``, kept in sync with ``indices``. */
+        index_t offset;
 
     public:
+        /** @copydoc default_constructor */
+        constexpr BufferIterator()
+            : pData(nullptr), pSize(nullptr), pStrides(nullptr), indices(BUFFER_INDEX_ZERO), offset(0)
+        {
+        }
+
         /**
          * @copydoc constructor
          *
@@ -67,18 +75,19 @@ namespace Heph
          * @param indices Buffer indices.
          */
         constexpr BufferIterator(pointer ptr, const buffer_size_t& size, const buffer_size_t& strides, const buffer_index_t& indices)
-            : pData(ptr), pSize(&size), pStrides(&strides), indices(indices)
+            : pData(ptr), pSize(&size), pStrides(&strides), indices(indices),
+            offset(std::inner_product(indices.begin(), indices.end(), strides.begin(), index_t(0)))
         {
         }
 
         /** Gets the element referenced by the iterator. */
-        constexpr HEPH_FORCE_INLINE reference operator*()
+        constexpr HEPH_FORCE_INLINE reference operator*() const
         {
-            return BufferIterator::Get<false>(this->pData, *this->pSize, *this->pStrides, this->indices);
+            return this->pData[this->offset];
         }
 
         /** Provides pointer-like access to the element referenced by the iterator. */
-        constexpr HEPH_FORCE_INLINE pointer operator->()
+        constexpr HEPH_FORCE_INLINE pointer operator->() const
         {
             return &this->operator*();
         }
@@ -114,7 +123,8 @@ namespace Heph
          */
         constexpr HEPH_FORCE_INLINE BufferIterator& operator+=(index_t i)
         {
-            this->IncrementIndex(NDimensions - 1, i);
+            if (i < 0) this->DecrementIndex(NDimensions - 1, -i);
+            else this->IncrementIndex(NDimensions - 1, i);
             return *this;
         }
 
@@ -161,7 +171,8 @@ namespace Heph
          */
         constexpr HEPH_FORCE_INLINE BufferIterator& operator-=(index_t i)
         {
-            this->DecrementIndex(NDimensions - 1, i);
+            if (i < 0) this->IncrementIndex(NDimensions - 1, -i);
+            else this->DecrementIndex(NDimensions - 1, i);
             return *this;
         }
 
@@ -185,7 +196,7 @@ namespace Heph
         }
 
         /** @copydoc operator++ */
-        constexpr HEPH_FORCE_INLINE BufferIterator& operator++(int)
+        constexpr HEPH_FORCE_INLINE BufferIterator operator++(int)
         {
             BufferIterator temp = *this;
             this->operator++();
@@ -200,19 +211,52 @@ namespace Heph
         }
 
         /** @copydoc operator-- */
-        constexpr HEPH_FORCE_INLINE BufferIterator& operator--(int)
+        constexpr HEPH_FORCE_INLINE BufferIterator operator--(int)
         {
             BufferIterator temp = *this;
             this->operator--();
             return temp;
         }
 
+        /**
+         * Gets the element at the provided distance from the iterator.
+         *
+         * @param i Number of elements to advance, in row-major order.
+         */
+        constexpr HEPH_FORCE_INLINE reference operator[](index_t i) const
+        {
+            return *(*this + i);
+        }
+
+        /** Gets the number of elements between two iterators of the same buffer, in row-major order. */
+        constexpr HEPH_FORCE_INLINE difference_type operator-(const BufferIterator& rhs) const
+        {
+            return this->Position() - rhs.Position();
+        }
+
         /** Checks whether both iterators belong to same buffer and at the same position. */
         constexpr HEPH_FORCE_INLINE bool operator==(const BufferIterator& rhs) const
         {
             return this->pData == rhs.pData && this->indices == rhs.indices;
         }
 
+        /** Compares the positions of two iterators of the same buffer. */
+        constexpr HEPH_FORCE_INLINE std::strong_ordering operator<=>(const BufferIterator& rhs) const
+        {
+            return this->Position() <=> rhs.Position();
+        }
+
+        /**
+         * Returns a new advanced iterator.
+         *
+         * @param i The value to add to the last dimension.
+         * @param rhs The iterator to advance.
+         */
+        friend constexpr HEPH_FORCE_INLINE BufferIterator operator+(index_t i, const BufferIterator& rhs)
+        {
+            return rhs + i;
+        }
+
         /** Gets the current indices. */
         constexpr HEPH_FORCE_INLINE const buffer_index_t& Indices() const
         {
@@ -222,41 +266,56 @@ namespace Heph
         /**
          * Moves the provided dimension of the iterator forward.
          *
+         * @note Overflowing indices are carried to the previous dimensions.
+         * Division is only needed when a dimension overflows by more than its size.
+         *
          * @param dim Dimension to move.
          * @param n The value to add.
          */
         constexpr void IncrementIndex(size_t dim, index_t n = 1)
         {
+            const buffer_size_t& size = *this->pSize;
+            const buffer_size_t& strides = *this->pStrides;
+
             this->indices[dim] += n;
+            this->offset += n * static_cast<index_t>(strides[dim]);
 
-            if (dim > 0)
+            for (; dim > 0 && this->indices[dim] >= static_cast<index_t>(size[dim]); --dim)
             {
-                n = this->indices[dim] / (*this->pSize)[dim];
-                this->indices[dim] %= (*this->pSize)[dim];
-                this->IncrementIndex(dim - 1, n);
+                const index_t s = size[dim];
+                const index_t carry = (this->indices[dim] < 2 * s) ? 1 : (this->indices[dim] / s);
+
+                this->indices[dim] -= carry * s;
+                this->indices[dim - 1] += carry;
+                this->offset += carry * (static_cast<index_t>(strides[dim - 1]) - s * static_cast<index_t>(strides[dim]));
             }
         }
 
         /**
          * Moves the provided dimension of the iterator backwards.
          *
+         * @note Underflowing indices are borrowed from the previous dimensions.
+         * Division is only needed when a dimension underflows by more than its size.
+         *
          * @param dim Dimension to move.
          * @param n The value to subtract.
          */
         constexpr void DecrementIndex(size_t dim, index_t n = 1)
         {
+            const buffer_size_t& size = *this->pSize;
+            const buffer_size_t& strides = *this->pStrides;
+
             this->indices[dim] -= n;
+            this->offset -= n * static_cast<index_t>(strides[dim]);
 
-            if (this->indices[dim] < 0)
+            for (; dim > 0 && this->indices[dim] < 0; --dim)
             {
-                n = ((-this->indices[dim]) / (*this->pSize)[dim]) + 1;
+                const index_t s = size[dim];
+                const index_t borrow = (this->indices[dim] >= -s) ? 1 : ((s - 1 - this->indices[dim]) / s);
 
-                // positive mod
-                const index_t s = (*this->pSize)[dim];
-                this->indices[dim] = (this->indices[dim] % s + s) % s;
-
-                if (dim > 0)
-                    this->DecrementIndex(dim - 1, n);
+                this->indices[dim] += borrow * s;
+                this->indices[dim - 1] -= borrow;
+                this->offset -= borrow * (static_cast<index_t>(strides[dim - 1]) - s * static_cast<index_t>(strides[dim]));
             }
         }
 
@@ -300,9 +359,19 @@ namespace Heph
                 }
             }
 
-            const index_t n = std::inner_product(indices.begin(), indices.end(), strides.begin(), 0);
+            const index_t n = std::inner_product(indices.begin(), indices.end(), strides.begin(), index_t(0));
             return ptr[n];
         }
+
+    private:
+        /** Gets the position of the iterator in row-major order. */
+        constexpr difference_type Position() const
+        {
+            difference_type position = 0;
+            for (size_t i = 0; i < NDimensions; ++i)
+                position = position * static_cast<difference_type>((*this->pSize)[i]) + this->indices[i];
+            return position;
+        }
     };
 
     /**
@@ -327,6 +396,8 @@ namespace Heph
         using reference = typename Traits::reference;
         /** @brief Iterator tag for std::iterator_traits. */
         using iterator_category = typename Traits::iterator_category;
+        /** @brief Iterator concept tag, elements of 1D buffers are adjacent in memory. */
+        using iterator_concept = std::contiguous_iterator_tag;
         /** @brief ``size_t`` for 1D buffers, an array of ``size_t`` for multidimensional buffers. */
         using buffer_size_t = typename Traits::buffer_size_t;
         /** @brief ``index_t`` for 1D buffers, an array of ``index_t`` for multidimensional buffers. */
@@ -342,29 +413,35 @@ namespace Heph
         pointer pData;
 
     public:
+        /** @copydoc default_constructor */
+        constexpr BufferIterator()
+            : pData(nullptr)
+        {
+        }
+
         /**
-             * @copydoc constructor
-             *
-             * @param ptr Pointer to the first element of the buffer.
-             * @param size Buffer size.
-             * @param strides Buffer strides.
-             * @param indices Buffer indices.
-             */
+         * @copydoc constructor
+         *
+         * @param ptr Pointer to the first element of the buffer.
+         * @param size Buffer size.
+         * @param strides Buffer strides.
+         * @param indices Buffer indices.
+         */
         constexpr BufferIterator(pointer ptr, const buffer_size_t& size, const buffer_size_t& strides, const buffer_index_t& indices)
             : pData(ptr + indices)
         {
         }
 
         /** Gets the element referenced by the iterator. */
-        constexpr HEPH_FORCE_INLINE reference operator*()
+        constexpr HEPH_FORCE_INLINE reference operator*() const
         {
             return *pData;
         }
 
         /** Provides pointer-like access to the element referenced by the iterator. */
-        constexpr HEPH_FORCE_INLINE pointer operator->()
+        constexpr HEPH_FORCE_INLINE pointer operator->() const
         {
-            return &this->operator*();
+            return this->pData;
         }
 
         /**
@@ -421,7 +498,7 @@ namespace Heph
         }
 
         /** @copydoc operator++ */
-        constexpr HEPH_FORCE_INLINE BufferIterator& operator++(int)
+        constexpr HEPH_FORCE_INLINE BufferIterator operator++(int)
         {
             BufferIterator temp = *this;
             this->operator++();
@@ -436,19 +513,52 @@ namespace Heph
         }
 
         /** @copydoc operator-- */
-        constexpr HEPH_FORCE_INLINE BufferIterator& operator--(int)
+        constexpr HEPH_FORCE_INLINE BufferIterator operator--(int)
         {
             BufferIterator temp = *this;
             this->operator--();
             return temp;
         }
 
+        /**
+         * Gets the element at the provided distance from the iterator.
+         *
+         * @param i Number of elements to advance.
+         */
+        constexpr HEPH_FORCE_INLINE reference operator[](index_t i) const
+        {
+            return this->pData[i];
+        }
+
+        /** Gets the number of elements between two iterators of the same buffer. */
+        constexpr HEPH_FORCE_INLINE difference_type operator-(const BufferIterator& rhs) const
+        {
+            return this->pData - rhs.pData;
+        }
+
         /** Checks whether both iterators belong to same buffer and at the same position. */
         constexpr HEPH_FORCE_INLINE bool operator==(const BufferIterator& rhs) const
         {
             return this->pData == rhs.pData;
         }
 
+        /** Compares the positions of two iterators of the same buffer. */
+        constexpr HEPH_FORCE_INLINE std::strong_ordering operator<=>(const BufferIterator& rhs) const
+        {
+            return this->pData <=> rhs.pData;
+        }
+
+        /**
+         * Returns a new advanced iterator.
+         *
+         * @param i The value to add.
+         * @param rhs The iterator to advance.
+         */
+        friend constexpr HEPH_FORCE_INLINE BufferIterator operator+(index_t i, const BufferIterator& rhs)
+        {
+            return rhs + i;
+        }
+
         /** Gets the current indices. */
         constexpr HEPH_FORCE_INLINE const buffer_index_t& Indices() const
         {
@@ -3,6 +3,7 @@
 
 #include "Heph/Concepts.h"
 #include <array>
+#include <iterator>
 #include <type_traits>
 
 /** @file */
@@ -34,9 +35,9 @@ namespace Heph
         { *it } -> std::same_as<typename T::reference>;
 
         { ++it } -> std::same_as<T&>;
-        { it++ } -> std::same_as<T&>;
+        { it++ } -> std::same_as<T>;
         { --it } -> std::same_as<T&>;
-        { it-- } -> std::same_as<T&>;
+        { it-- } -> std::same_as<T>;
 
         { it.Indices() } -> std::convertible_to<typename T::buffer_index_t>;
 
@@ -70,7 +71,7 @@ namespace Heph
         /** @brief Reference type for std::iterator_traits. */
         using reference = value_type&;
         /** @brief Iterator tag for std::iterator_traits. */
-        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         /** @brief ``size_t`` for 1D buffers, an array of ``size_t`` for multidimensional buffers. */
         using buffer_size_t = std::conditional_t<NDimensions == 1, size_t, std::array<size_t, NDimensions>>;
         /** @brief ``index_t`` for 1D buffers, an array of ``index_t`` for multidimensional buffers. */
@@ -4,6 +4,9 @@
 #include "Heph/Utils.h"
 #include "Heph/Buffers/Iterators/BufferIteratorConcept.h"
 #include "Heph/Exceptions/InvalidArgumentException.h"
+#include "Heph/Exceptions/InvalidOperationException.h"
+#include <compare>
+#include <bit>
 
 /** @file */
 
@@ -14,8 +17,10 @@ namespace Heph
      *
      * @tparam TData Type of the elements stored in buffer.
      * @tparam NDimensions Number of dimensions the buffer has.
+     * @tparam PowerOfTwoSize Specifies that each dimension of the buffer has a power-of-two size,
+     * so the indices can be wrapped with a bitmask instead of a division. Use Heph::PowerOfTwoCircularBufferIterator for buffers.
      */
-    template<BufferElement TData, size_t NDimensions>
+    template<BufferElement TData, size_t NDimensions, bool PowerOfTwoSize = false>
         requires (NDimensions > 0)
     class HEPH_API CircularBufferIterator final
     {
@@ -54,6 +59,12 @@ namespace Heph
         buffer_index_t indices;
 
     public:
+        /** @copydoc default_constructor */
+        constexpr CircularBufferIterator()
+            : pData(nullptr), pSize(nullptr), pStrides(nullptr), indices(BUFFER_INDEX_ZERO)
+        {
+        }
+
         /**
          * @copydoc constructor
          *
@@ -61,20 +72,22 @@ namespace Heph
          * @param size Buffer size.
          * @param strides Buffer strides.
          * @param indices Buffer indices.
+         * @exception InvalidOperationException
          */
         constexpr CircularBufferIterator(pointer ptr, const buffer_size_t& size, const buffer_size_t& strides, const buffer_index_t& indices)
             : pData(ptr), pSize(&size), pStrides(&strides), indices(indices)
         {
+            if constexpr (PowerOfTwoSize) CircularBufferIterator::ValidateSize(size);
         }
 
         /** Gets the element referenced by the iterator. */
-        constexpr HEPH_FORCE_INLINE reference operator*()
+        constexpr HEPH_FORCE_INLINE reference operator*() const
         {
             return CircularBufferIterator::Get<false>(this->pData, *this->pSize, *this->pStrides, this->indices);
         }
 
         /** Provides pointer-like access to the element referenced by the iterator. */
-        constexpr HEPH_FORCE_INLINE pointer operator->()
+        constexpr HEPH_FORCE_INLINE pointer operator->() const
         {
             return &this->operator*();
         }
@@ -112,7 +125,8 @@ namespace Heph
          */
         constexpr HEPH_FORCE_INLINE CircularBufferIterator& operator+=(index_t i)
         {
-            this->IncrementIndex(NDimensions - 1, i);
+            if (i < 0) this->DecrementIndex(NDimensions - 1, -i);
+            else this->IncrementIndex(NDimensions - 1, i);
 
             return *this;
         }
@@ -167,7 +181,8 @@ namespace Heph
          */
         constexpr HEPH_FORCE_INLINE CircularBufferIterator& operator-=(index_t i)
         {
-            this->DecrementIndex(NDimensions - 1, i);
+            if (i < 0) this->IncrementIndex(NDimensions - 1, -i);
+            else this->DecrementIndex(NDimensions - 1, i);
             return *this;
         }
 
@@ -198,7 +213,7 @@ namespace Heph
         }
 
         /** @copydoc operator++ */
-        constexpr HEPH_FORCE_INLINE CircularBufferIterator& operator++(int)
+        constexpr HEPH_FORCE_INLINE CircularBufferIterator operator++(int)
         {
             CircularBufferIterator temp = *this;
             this->operator++();
@@ -215,19 +230,52 @@ namespace Heph
         }
 
         /** @copydoc operator-- */
-        constexpr HEPH_FORCE_INLINE CircularBufferIterator& operator--(int)
+        constexpr HEPH_FORCE_INLINE CircularBufferIterator operator--(int)
         {
             CircularBufferIterator temp = *this;
             this->operator--();
             return temp;
         }
 
+        /**
+         * Gets the element at the provided distance from the iterator.
+         *
+         * @param i Number of elements to advance, in row-major order.
+         */
+        constexpr HEPH_FORCE_INLINE reference operator[](index_t i) const
+        {
+            return *(*this + i);
+        }
+
+        /** Gets the number of elements between two iterators of the same buffer, in row-major order. */
+        constexpr HEPH_FORCE_INLINE difference_type operator-(const CircularBufferIterator& rhs) const
+        {
+            return this->Position() - rhs.Position();
+        }
+
         /** Checks whether both iterators belong to same buffer and at the same position. */
         constexpr HEPH_FORCE_INLINE bool operator==(const CircularBufferIterator& rhs) const
         {
             return this->pData == rhs.pData && this->indices == rhs.indices;
         }
 
+        /** Compares the positions of two iterators of the same buffer. */
+        constexpr HEPH_FORCE_INLINE std::strong_ordering operator<=>(const CircularBufferIterator& rhs) const
+        {
+            return this->Position() <=> rhs.Position();
+        }
+
+        /**
+         * Returns a new advanced iterator.
+         *
+         * @param i The value to add to the last dimension.
+         * @param rhs The iterator to advance.
+         */
+        friend constexpr HEPH_FORCE_INLINE CircularBufferIterator operator+(index_t i, const CircularBufferIterator& rhs)
+        {
+            return rhs + i;
+        }
+
         /** Gets the current indices. */
         constexpr HEPH_FORCE_INLINE const buffer_index_t& Indices() const
         {
@@ -249,8 +297,17 @@ namespace Heph
 
                 if (dim > 0)
                 {
-                    n = this->indices[dim] / (*this->pSize)[dim];
-                    this->indices[dim] %= (*this->pSize)[dim];
+                    if constexpr (PowerOfTwoSize)
+                    {
+                        // arithmetic shift floors, so this also handles negative indices
+                        n = this->indices[dim] >> std::countr_zero((*this->pSize)[dim]);
+                        this->indices[dim] &= (*this->pSize)[dim] - 1;
+                    }
+                    else
+                    {
+                        n = this->indices[dim] / (*this->pSize)[dim];
+                        this->indices[dim] %= (*this->pSize)[dim];
+                    }
                     this->IncrementIndex(dim - 1, n);
                 }
             }
@@ -265,16 +322,17 @@ namespace Heph
         constexpr void DecrementIndex(size_t dim, index_t n = 1)
         {
             if constexpr (NDimensions == 1) this->indices -= n;
+            else if constexpr (PowerOfTwoSize) this->IncrementIndex(dim, -n);
             else
             {
                 this->indices[dim] -= n;
 
                 if (this->indices[dim] < 0)
                 {
-                    n = ((-this->indices[dim]) / (*this->pSize)[dim]) + 1;
+                    const index_t s = (*this->pSize)[dim];
+                    n = ((-this->indices[dim]) + s - 1) / s;
 
                     // positive mod
-                    const index_t s = (*this->pSize)[dim];
                     this->indices[dim] = (this->indices[dim] % s + s) % s;
 
                     if (dim > 0)
@@ -314,19 +372,94 @@ namespace Heph
         template<bool CheckErrors>
         static constexpr HEPH_FORCE_INLINE reference Get(pointer ptr, const buffer_size_t& size, const buffer_size_t& strides, const buffer_index_t& indices)
         {
+            if constexpr (CheckErrors && PowerOfTwoSize) CircularBufferIterator::ValidateSize(size);
+
             if constexpr (NDimensions == 1)
             {
-                return ptr[indices % size];
+                return ptr[CircularBufferIterator::Wrap(indices, size)];
             }
             else
             {
                 index_t n = 0;
                 for (size_t i = 0; i < NDimensions; ++i)
-                    n += (indices[i] % size[i]) * strides[i];
+                    n += CircularBufferIterator::Wrap(indices[i], size[i]) * strides[i];
                 return ptr[n];
             }
         }
+
+    private:
+        /**
+         * Checks whether each dimension has a power-of-two size, which the bitmask wrapping relies on.
+         * Empty dimensions are accepted since there are no elements to wrap to.
+         *
+         * @param size Buffer size.
+         * @exception InvalidOperationException
+         */
+        static constexpr void ValidateSize(const buffer_size_t& size)
+        {
+            if constexpr (NDimensions == 1)
+            {
+                if (size != 0 && !std::has_single_bit(size))
+                {
+                    HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Buffer size must be a power of two.");
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < NDimensions; ++i)
+                {
+                    if (size[i] != 0 && !std::has_single_bit(size[i]))
+                    {
+                        HEPH_EXCEPTION_RAISE_AND_THROW(InvalidOperationException, HEPH_FUNC, "Buffer size must be a power of two.");
+                    }
+                }
+            }
+        }
+
+        /**
+         * Wraps an index to [0, size).
+         *
+         * @param index The index to wrap, may be negative.
+         * @param size Size of the dimension.
+         */
+        static constexpr HEPH_FORCE_INLINE index_t Wrap(index_t index, size_t size)
+        {
+            if constexpr (PowerOfTwoSize)
+            {
+                return index & static_cast<index_t>(size - 1);
+            }
+            else
+            {
+                const index_t result = index % static_cast<index_t>(size);
+                return (result < 0) ? (result + static_cast<index_t>(size)) : result;
+            }
+        }
+
+        /** Gets the unwrapped position of the iterator in row-major order. */
+        constexpr difference_type Position() const
+        {
+            if constexpr (NDimensions == 1) return this->indices;
+            else
+            {
+                difference_type position = 0;
+                for (size_t i = 0; i < NDimensions; ++i)
+                    position = position * static_cast<difference_type>((*this->pSize)[i]) + this->indices[i];
+                return position;
+            }
+        }
     };
+
+    /**
+     * @brief Circular iterator for Heph::Buffer whose dimensions all have power-of-two sizes.
+     * Wraps the indices with a bitmask instead of a division.
+     *
+     * @note Creating an iterator, or accessing the elements via ``At``, throws if any dimension does not have a power-of-two size.
+     *
+     * @tparam TData Type of the elements stored in buffer.
+     * @tparam NDimensions Number of dimensions the buffer has.
+     */
+    template<BufferElement TData, size_t NDimensions>
+    using PowerOfTwoCircularBufferIterator = CircularBufferIterator<TData, NDimensions, true>;
 }
 
 #endif
\ No newline at end of file
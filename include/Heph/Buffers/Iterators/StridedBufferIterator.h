@@ -0,0 +1,250 @@
+#ifndef HEPH_STRIDED_BUFFER_ITERATOR_H
+#define HEPH_STRIDED_BUFFER_ITERATOR_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/Iterators/BufferIteratorConcept.h"
+#include "Heph/Exceptions/InvalidArgumentException.h"
+#include <compare>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Iterator for 1D buffer views whose elements are not adjacent in memory.
+     *
+     * @note Multidimensional views use Heph::BufferIterator, which already honours the strides.
+     *
+     * @tparam TData Type of the elements.
+     */
+    template<BufferElement TData>
+    class HEPH_API StridedBufferIterator final
+    {
+    public:
+        /** @copybrief BufferIteratorTraits */
+        using Traits = BufferIteratorTraits<TData, 1>;
+
+        /** @brief Difference type for std::iterator_traits. */
+        using difference_type = typename Traits::difference_type;
+        /** @brief Value type for std::iterator_traits. */
+        using value_type = typename Traits::value_type;
+        /** @brief Pointer type for std::iterator_traits. */
+        using pointer = typename Traits::pointer;
+        /** @brief Reference type for std::iterator_traits. */
+        using reference = typename Traits::reference;
+        /** @brief Iterator tag for std::iterator_traits. */
+        using iterator_category = typename Traits::iterator_category;
+        /** @brief ``size_t`` for 1D buffers, an array of ``size_t`` for multidimensional buffers. */
+        using buffer_size_t = typename Traits::buffer_size_t;
+        /** @brief ``index_t`` for 1D buffers, an array of ``index_t`` for multidimensional buffers. */
+        using buffer_index_t = typename Traits::buffer_index_t;
+
+    private:
+        /** @brief Pointer to the current element. */
+        pointer pData;
+        /** @brief Number of elements to advance in one step, 0 for broadcast views. */
+        index_t stride;
+        /** @brief Index of the current element, positions are compared by it since the pointer does not move if the stride is 0. */
+        index_t index;
+
+    public:
+        /** @copydoc default_constructor */
+        constexpr StridedBufferIterator()
+            : pData(nullptr), stride(1), index(0)
+        {
+        }
+
+        /**
+         * @copydoc constructor
+         *
+         * @param ptr Pointer to the first element of the view.
+         * @param size View size.
+         * @param strides View strides.
+         * @param indices View indices.
+         */
+        constexpr StridedBufferIterator(pointer ptr, const buffer_size_t& size, const buffer_size_t& strides, const buffer_index_t& indices)
+            : pData(ptr + indices * static_cast<index_t>(strides)), stride(strides), index(indices)
+        {
+        }
+
+        /** Gets the element referenced by the iterator. */
+        constexpr HEPH_FORCE_INLINE reference operator*() const
+        {
+            return *this->pData;
+        }
+
+        /** Provides pointer-like access to the element referenced by the iterator. */
+        constexpr HEPH_FORCE_INLINE pointer operator->() const
+        {
+            return this->pData;
+        }
+
+        /**
+         * Returns a new advanced iterator.
+         *
+         * @param i Number of elements to advance.
+         */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator operator+(index_t i) const
+        {
+            StridedBufferIterator result = *this;
+            result += i;
+            return result;
+        }
+
+        /**
+         * Moves the iterator forward.
+         *
+         * @param i Number of elements to advance.
+         */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator& operator+=(index_t i)
+        {
+            this->pData += i * this->stride;
+            this->index += i;
+            return *this;
+        }
+
+        /**
+         * Returns a new moved back iterator.
+         *
+         * @param i Number of elements to move back.
+         */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator operator-(index_t i) const
+        {
+            StridedBufferIterator result = *this;
+            result -= i;
+            return result;
+        }
+
+        /**
+         * Moves the iterator backwards.
+         *
+         * @param i Number of elements to move back.
+         */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator& operator-=(index_t i)
+        {
+            this->pData -= i * this->stride;
+            this->index -= i;
+            return *this;
+        }
+
+        /** Moves the iterator forward by one. */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator& operator++()
+        {
+            this->pData += this->stride;
+            ++this->index;
+            return *this;
+        }
+
+        /** @copydoc operator++ */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator operator++(int)
+        {
+            StridedBufferIterator temp = *this;
+            this->operator++();
+            return temp;
+        }
+
+        /** Moves the iterator backwards by one. */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator& operator--()
+        {
+            this->pData -= this->stride;
+            --this->index;
+            return *this;
+        }
+
+        /** @copydoc operator-- */
+        constexpr HEPH_FORCE_INLINE StridedBufferIterator operator--(int)
+        {
+            StridedBufferIterator temp = *this;
+            this->operator--();
+            return temp;
+        }
+
+        /**
+         * Gets the element at the provided distance from the iterator.
+         *
+         * @param i Number of elements to advance.
+         */
+        constexpr HEPH_FORCE_INLINE reference operator[](index_t i) const
+        {
+            return this->pData[i * this->stride];
+        }
+
+        /** Gets the number of elements between two iterators of the same view. */
+        constexpr HEPH_FORCE_INLINE difference_type operator-(const StridedBufferIterator& rhs) const
+        {
+            return this->index - rhs.index;
+        }
+
+        /** Checks whether both iterators are at the same position. */
+        constexpr HEPH_FORCE_INLINE bool operator==(const StridedBufferIterator& rhs) const
+        {
+            return this->index == rhs.index;
+        }
+
+        /** Compares the positions of two iterators of the same view. */
+        constexpr HEPH_FORCE_INLINE std::strong_ordering operator<=>(const StridedBufferIterator& rhs) const
+        {
+            return this->index <=> rhs.index;
+        }
+
+        /**
+         * Returns a new advanced iterator.
+         *
+         * @param i Number of elements to advance.
+         * @param rhs The iterator to advance.
+         */
+        friend constexpr HEPH_FORCE_INLINE StridedBufferIterator operator+(index_t i, const StridedBufferIterator& rhs)
+        {
+            return rhs + i;
+        }
+
+        /**
+         * Moves the iterator forward.
+         *
+         * @param dim Dimension to move, must be 0.
+         * @param n The value to add.
+         */
+        constexpr HEPH_FORCE_INLINE void IncrementIndex(size_t dim, index_t n = 1)
+        {
+            this->pData += n * this->stride;
+            this->index += n;
+        }
+
+        /**
+         * Moves the iterator backwards.
+         *
+         * @param dim Dimension to move, must be 0.
+         * @param n The value to subtract.
+         */
+        constexpr HEPH_FORCE_INLINE void DecrementIndex(size_t dim, index_t n = 1)
+        {
+            this->pData -= n * this->stride;
+            this->index -= n;
+        }
+
+        /**
+         * Gets a reference to the element at the provided index.
+         *
+         * @tparam CheckErrors Determines whether to validate the index.
+         * @param ptr Pointer to the first element of the view.
+         * @param size View size.
+         * @param strides View strides.
+         * @param indices Index of the element.
+         */
+        template<bool CheckErrors>
+        static constexpr HEPH_FORCE_INLINE reference Get(pointer ptr, const buffer_size_t& size, const buffer_size_t& strides, const buffer_index_t& indices)
+        {
+            if constexpr (CheckErrors)
+            {
+                if (indices < 0 || indices >= size)
+                {
+                    HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Index out of bounds.");
+                }
+            }
+
+            return ptr[indices * static_cast<index_t>(strides)];
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef HEPH_ARITHMETIC_KERNELS_H
+#define HEPH_ARITHMETIC_KERNELS_H
+
+#include "Heph/Utils.h"
+#include <complex>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+
+/** @file */
+
+namespace Heph
+{
+    /** @brief Specifies that the element-wise kernels are implemented for the type ``T``. */
+    template<typename T>
+    concept ArithmeticKernelElement =
+        std::same_as<T, float> || std::same_as<T, double> ||
+        std::same_as<T, int32_t> || std::same_as<T, int64_t> ||
+        std::same_as<T, std::complex<double>>;
+
+    /**
+     * @brief Specifies that applying an operator with a constant of type ``TRhs`` to an element of type ``TData``
+     * gives the same result as applying it with the constant converted to ``TData``, so the kernels can be used.
+     */
+    template<typename TData, typename TRhs>
+    concept ArithmeticKernelScalar = ArithmeticKernelElement<TData> &&
+        (std::same_as<TData, TRhs> || (std::is_arithmetic_v<TData> && std::is_arithmetic_v<TRhs> && std::same_as<std::common_type_t<TData, TRhs>, TData>));
+
+    /**
+     * @brief Vectorized element-wise operations on contiguous memory, used by the \ref ArithmeticBuffer "ArithmeticBuffer".
+     *
+     * @note Kernels use the instruction set selected by the \ref KernelDispatch "KernelDispatch" (AVX-512, AVX2 or SSE2), and plain loops on other targets.
+     * Operations the instruction set has no instructions for (e.g. integer division) always use plain loops.
+     * The out-of-place overloads store the results to ``dest`` without reading it, hence it can be uninitialized memory.
+     * The ``dest``, ``lhs`` and ``rhs`` arrays can be the same, but must not partially overlap.
+     */
+    class HEPH_API ArithmeticKernels final
+    {
+    public:
+        HEPH_DISABLE_INSTANCE(ArithmeticKernels);
+
+        /**
+         * Adds the elements of ``rhs`` to the elements of ``lhs``.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Add(T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Adds a constant to the elements of ``lhs``.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Add(T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Adds the elements of ``lhs`` and ``rhs``, and stores the results to ``dest``.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Add(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Adds a constant to the elements of ``lhs``, and stores the results to ``dest``.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Add(T* pDest, const T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Subtracts the elements of ``rhs`` from the elements of ``lhs``.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Subtract(T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Subtracts a constant from the elements of ``lhs``.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Subtract(T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Subtracts the elements of ``rhs`` from the elements of ``lhs``, and stores the results to ``dest``.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Subtract(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Subtracts a constant from the elements of ``lhs``, and stores the results to ``dest``.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Subtract(T* pDest, const T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Multiplies the elements of ``lhs`` with the elements of ``rhs``.
+         *
+         * @note Complex multiplication does not apply the C99 Annex G rules for infinite and NaN operands.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Multiply(T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Multiplies the elements of ``lhs`` with a constant.
+         *
+         * @note Complex multiplication does not apply the C99 Annex G rules for infinite and NaN operands.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Multiply(T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Multiplies the elements of ``lhs`` with the elements of ``rhs``, and stores the results to ``dest``.
+         *
+         * @note Complex multiplication does not apply the C99 Annex G rules for infinite and NaN operands.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Multiply(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Multiplies the elements of ``lhs`` with a constant, and stores the results to ``dest``.
+         *
+         * @note Complex multiplication does not apply the C99 Annex G rules for infinite and NaN operands.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Multiply(T* pDest, const T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Multiplies the real and imaginary parts of the elements of ``lhs`` with a constant.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        static void Multiply(std::complex<double>* pLhs, double rhs, size_t count);
+
+        /**
+         * Divides the elements of ``lhs`` by the elements of ``rhs``.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Divide(T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Divides the elements of ``lhs`` by a constant.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Divide(T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Divides the elements of ``lhs`` by the elements of ``rhs``, and stores the results to ``dest``.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param pRhs Pointer to the first element of the right operand.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Divide(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+
+        /**
+         * Divides the elements of ``lhs`` by a constant, and stores the results to ``dest``.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pLhs Pointer to the first element of the left operand.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        template<ArithmeticKernelElement T>
+        static void Divide(T* pDest, const T* pLhs, const T& rhs, size_t count);
+
+        /**
+         * Divides the real and imaginary parts of the elements of ``lhs`` by a constant.
+         *
+         * @param pLhs Pointer to the first element of the destination.
+         * @param rhs The constant.
+         * @param count Number of elements.
+         */
+        static void Divide(std::complex<double>* pLhs, double rhs, size_t count);
+
+        /**
+         * Converts floats to doubles, and stores the results to ``dest``.
+         *
+         * @note The arrays must not overlap.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pSrc Pointer to the first element of the source.
+         * @param count Number of elements.
+         */
+        static void Convert(double* pDest, const float* pSrc, size_t count);
+
+        /**
+         * Converts doubles to floats, and stores the results to ``dest``.
+         *
+         * @note The arrays must not overlap.
+         *
+         * @param pDest Pointer to the first element of the destination.
+         * @param pSrc Pointer to the first element of the source.
+         * @param count Number of elements.
+         */
+        static void Convert(float* pDest, const double* pSrc, size_t count);
+    };
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef HEPH_KERNEL_DISPATCH_H
+#define HEPH_KERNEL_DISPATCH_H
+
+#include "Heph/Utils.h"
+
+/** @file */
+
+namespace Heph
+{
+    /** @brief Defines the instruction sets the vector kernels are implemented for, in ascending order. */
+    enum InstructionSet
+    {
+        /** @brief Plain loops, available on all targets. */
+        Generic,
+        /** @brief 128-bit SSE2 instructions. */
+        SSE2,
+        /** @brief 256-bit AVX2 instructions. */
+        AVX2,
+        /** @brief 512-bit AVX-512 foundation instructions. */
+        AVX512
+    };
+
+    /**
+     * @brief Selects the implementation of the vector kernels at runtime.
+     *
+     * The CPU features are detected with ``cpuid`` on first use and the widest supported instruction set is chosen,
+     * so the library does not need to be compiled with ``-march`` flags.
+     * The choice can be lowered by setting the ``HEPH_KERNEL_ISA`` environment variable
+     * to one of the names returned by InstructionSetName (e.g. ``HEPH_KERNEL_ISA=sse2``) before the first kernel call.
+     */
+    class HEPH_API KernelDispatch final
+    {
+    public:
+        HEPH_DISABLE_INSTANCE(KernelDispatch);
+
+        /** @brief Name of the environment variable that forces an instruction set. */
+        static constexpr const char* ENVIRONMENT_VARIABLE = "HEPH_KERNEL_ISA";
+
+        /** Gets the widest instruction set supported by both the CPU and the library. */
+        static InstructionSet SupportedInstructionSet() noexcept;
+
+        /** Gets the instruction set the kernels currently use. */
+        static InstructionSet ActiveInstructionSet() noexcept;
+
+        /**
+         * Changes the instruction set the kernels use.
+         *
+         * @note Instruction sets wider than SupportedInstructionSet are lowered to it.
+         *
+         * @param instructionSet The instruction set to use.
+         * @return The instruction set that is actually used.
+         */
+        static InstructionSet SetInstructionSet(InstructionSet instructionSet) noexcept;
+
+        /**
+         * Gets the name of the instruction set, in the format used by the ``HEPH_KERNEL_ISA`` environment variable.
+         *
+         * @param instructionSet The instruction set.
+         * @return ``"generic"``, ``"sse2"``, ``"avx2"``, or ``"avx512"``.
+         */
+        static const char* InstructionSetName(InstructionSet instructionSet) noexcept;
+    };
+}
+
+#endif
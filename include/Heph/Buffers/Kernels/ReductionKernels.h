@@ -0,0 +1,90 @@
+#ifndef HEPH_REDUCTION_KERNELS_H
+#define HEPH_REDUCTION_KERNELS_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/BufferStatistics.h"
+#include <concepts>
+
+/** @file */
+
+namespace Heph
+{
+    /** @brief Specifies that the reduction kernels are implemented for the type ``T``. */
+    template<typename T>
+    concept ReductionKernelElement = std::same_as<T, float> || std::same_as<T, double>;
+
+    /**
+     * @brief Vectorized reductions on contiguous memory, used by the \ref ArithmeticBuffer "ArithmeticBuffer".
+     *
+     * @note Kernels use the instruction set selected by the \ref KernelDispatch "KernelDispatch".
+     * NaN elements are skipped by Min, Max and AbsMax.
+     */
+    class HEPH_API ReductionKernels final
+    {
+    public:
+        HEPH_DISABLE_INSTANCE(ReductionKernels);
+
+        /**
+         * Finds the minimum element.
+         *
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         * @return The minimum element, or the largest finite value of ``T`` if there are no elements.
+         */
+        template<ReductionKernelElement T>
+        static T Min(const T* pData, size_t count);
+
+        /**
+         * Finds the maximum element.
+         *
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         * @return The maximum element, or the lowest finite value of ``T`` if there are no elements.
+         */
+        template<ReductionKernelElement T>
+        static T Max(const T* pData, size_t count);
+
+        /**
+         * Finds the maximum absolute value.
+         *
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         * @return The maximum absolute value, or the lowest finite value of ``T`` if there are no elements.
+         */
+        template<ReductionKernelElement T>
+        static T AbsMax(const T* pData, size_t count);
+
+        /**
+         * Calculates the sum of the elements.
+         *
+         * @note The elements are summed in double precision.
+         *
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         */
+        template<ReductionKernelElement T>
+        static double Sum(const T* pData, size_t count);
+
+        /**
+         * Calculates the sum of the squares of the elements.
+         *
+         * @note The squares are summed in double precision with Kahan compensation.
+         *
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         */
+        template<ReductionKernelElement T>
+        static double SumOfSquares(const T* pData, size_t count);
+
+        /**
+         * Calculates the min, max, absolute max, sum, mean, variance and rms of the elements with a single pass over the memory.
+         *
+         * @param pData Pointer to the first element.
+         * @param count Number of elements.
+         */
+        template<ReductionKernelElement T>
+        static BufferStatistics<T> Statistics(const T* pData, size_t count);
+    };
+}
+
+#endif
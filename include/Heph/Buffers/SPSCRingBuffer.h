@@ -0,0 +1,291 @@
+#ifndef HEPH_SPSC_RING_BUFFER_H
+#define HEPH_SPSC_RING_BUFFER_H
+
+#include "Heph/Utils.h"
+#include "Heph/Buffers/Buffer.h"
+#include "Heph/Exceptions/InvalidArgumentException.h"
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include <bit>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Wait-free ring buffer for passing elements from one producer thread to one consumer thread.
+     *
+     * @note Only one thread may call the producer methods (``Write*``, ``CommitWrite``)
+     * and only one thread may call the consumer methods (``Read*``, ``CommitRead``) at a time.
+     * The read and write indices are kept on separate cache lines so the two threads do not invalidate each other's cache.
+     *
+     * @tparam TData Type of the elements stored in buffer.
+     * @tparam TAllocator Type of the allocator.
+     */
+    template <
+        BufferElement TData,
+        template<typename> typename TAllocator = BufferAllocator
+    >
+    class HEPH_API SPSCRingBuffer
+    {
+    public:
+        /** @brief Type of the buffer that stores the elements. */
+        using storage_type = Buffer<TData, 1, BufferIterator, TAllocator>;
+        /** @copybrief Buffer::allocator_type */
+        using allocator_type = typename storage_type::allocator_type;
+        /** @copybrief Buffer::view_type */
+        using view_type = typename storage_type::view_type;
+        /** @copybrief Buffer::const_view_type */
+        using const_view_type = typename storage_type::const_view_type;
+
+    protected:
+        /** @brief Memory of the ring, its size is a power of two. */
+        storage_type storage;
+        /** @brief Pointer to the first element of the ring. */
+        TData* pData;
+        /** @brief Mask for wrapping the indices, capacity - 1. */
+        size_t mask;
+
+        /** @brief Total number of elements written, only modified by the producer. */
+        alignas(HEPH_CACHE_LINE_SIZE) std::atomic<size_t> writeIndex;
+        /** @brief Last read index seen by the producer, avoids touching the consumer's cache line on every write. */
+        size_t cachedReadIndex;
+
+        /** @brief Total number of elements read, only modified by the consumer. */
+        alignas(HEPH_CACHE_LINE_SIZE) std::atomic<size_t> readIndex;
+        /** @brief Last write index seen by the consumer, avoids touching the producer's cache line on every read. */
+        size_t cachedWriteIndex;
+
+    public:
+        /**
+         * @copydoc constructor
+         *
+         * @param capacity Minimum number of elements the buffer can hold, rounded up to a power of two.
+         * @param allocator @copybrief Buffer::allocator
+         * @exception InvalidArgumentException
+         * @exception InsufficientMemoryException
+         */
+        explicit SPSCRingBuffer(size_t capacity, const allocator_type& allocator = allocator_type())
+            : storage(allocator), pData(nullptr), mask(0), writeIndex(0), cachedReadIndex(0), readIndex(0), cachedWriteIndex(0)
+        {
+            if (capacity == 0)
+            {
+                HEPH_EXCEPTION_RAISE_AND_THROW(InvalidArgumentException, HEPH_FUNC, "Capacity cannot be 0.");
+            }
+
+            capacity = std::bit_ceil(capacity);
+            this->storage = storage_type(typename storage_type::buffer_size_t(capacity), allocator);
+            this->pData = this->storage.View().Data();
+            this->mask = capacity - 1;
+        }
+
+        HEPH_DISABLE_COPY(SPSCRingBuffer);
+
+        /** @copydoc destructor */
+        virtual ~SPSCRingBuffer() = default;
+
+        /** Gets the number of elements the buffer can hold. */
+        size_t Capacity() const
+        {
+            return this->mask + 1;
+        }
+
+        /**
+         * Gets the number of elements that can be written.
+         *
+         * @note Producer only.
+         */
+        size_t WriteAvailable()
+        {
+            this->cachedReadIndex = this->readIndex.load(std::memory_order_acquire);
+            return this->Capacity() - (this->writeIndex.load(std::memory_order_relaxed) - this->cachedReadIndex);
+        }
+
+        /**
+         * Gets the free space as two contiguous spans, the second one is non-empty when the free space wraps around the end of the ring.
+         * Write to the spans, then call CommitWrite to publish the elements.
+         *
+         * @note Producer only.
+         */
+        std::pair<view_type, view_type> WriteSpans()
+        {
+            const size_t available = this->WriteAvailable();
+            return this->Spans<TData>(this->writeIndex.load(std::memory_order_relaxed), available);
+        }
+
+        /**
+         * Publishes the elements written to the spans returned by WriteSpans.
+         *
+         * @note Producer only.
+         *
+         * @param n Number of elements to publish, cannot exceed the size of the spans.
+         */
+        void CommitWrite(size_t n)
+        {
+            this->writeIndex.store(this->writeIndex.load(std::memory_order_relaxed) + n, std::memory_order_release);
+        }
+
+        /**
+         * Copies the elements to the buffer.
+         *
+         * @note Producer only.
+         *
+         * @param src The elements to write.
+         * @return Number of elements written, less than the source size if the buffer does not have enough room.
+         */
+        size_t Write(const const_view_type& src)
+        {
+            const size_t w = this->writeIndex.load(std::memory_order_relaxed);
+            size_t n = src.Size();
+
+            if (n > this->Capacity() - (w - this->cachedReadIndex))
+            {
+                n = std::min(n, this->WriteAvailable());
+                if (n == 0) return 0;
+            }
+
+            const size_t start = w & this->mask;
+            const size_t firstCount = std::min(n, this->Capacity() - start);
+
+            src.Slice(0, 0, firstCount).CopyTo(this->pData + start);
+            src.Slice(0, firstCount, n - firstCount).CopyTo(this->pData);
+
+            this->writeIndex.store(w + n, std::memory_order_release);
+            return n;
+        }
+
+        /**
+         * Copies the element to the buffer.
+         *
+         * @note Producer only.
+         *
+         * @param element The element to write.
+         * @return ``true`` if the element is written, ``false`` if the buffer is full.
+         */
+        bool Write(const TData& element)
+        {
+            const size_t w = this->writeIndex.load(std::memory_order_relaxed);
+            if (w - this->cachedReadIndex == this->Capacity() && this->WriteAvailable() == 0) return false;
+
+            this->pData[w & this->mask] = element;
+            this->writeIndex.store(w + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Gets the number of elements that can be read.
+         *
+         * @note Consumer only.
+         */
+        size_t ReadAvailable()
+        {
+            this->cachedWriteIndex = this->writeIndex.load(std::memory_order_acquire);
+            return this->cachedWriteIndex - this->readIndex.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Gets the readable elements as two contiguous spans, the second one is non-empty when the elements wrap around the end of the ring.
+         * Read from the spans, then call CommitRead to release the memory to the producer.
+         *
+         * @note Consumer only.
+         */
+        std::pair<const_view_type, const_view_type> ReadSpans()
+        {
+            const size_t available = this->ReadAvailable();
+            return this->Spans<const TData>(this->readIndex.load(std::memory_order_relaxed), available);
+        }
+
+        /**
+         * Releases the elements read from the spans returned by ReadSpans.
+         *
+         * @note Consumer only.
+         *
+         * @param n Number of elements to release, cannot exceed the size of the spans.
+         */
+        void CommitRead(size_t n)
+        {
+            this->readIndex.store(this->readIndex.load(std::memory_order_relaxed) + n, std::memory_order_release);
+        }
+
+        /**
+         * Removes the oldest elements and copies them.
+         *
+         * @note Consumer only.
+         *
+         * @param dest The view to copy the elements to.
+         * @return Number of elements read, less than the destination size if the buffer does not have enough elements.
+         */
+        size_t Read(const view_type& dest)
+        {
+            const size_t r = this->readIndex.load(std::memory_order_relaxed);
+            size_t n = dest.Size();
+
+            if (n > this->cachedWriteIndex - r)
+            {
+                n = std::min(n, this->ReadAvailable());
+                if (n == 0) return 0;
+            }
+
+            const size_t start = r & this->mask;
+            const size_t firstCount = std::min(n, this->Capacity() - start);
+
+            SPSCRingBuffer::Copy(this->pData + start, dest.Slice(0, 0, firstCount));
+            SPSCRingBuffer::Copy(this->pData, dest.Slice(0, firstCount, n - firstCount));
+
+            this->readIndex.store(r + n, std::memory_order_release);
+            return n;
+        }
+
+        /**
+         * Removes the oldest element and copies it.
+         *
+         * @note Consumer only.
+         *
+         * @param element The destination of the element.
+         * @return ``true`` if an element is read, ``false`` if the buffer is empty.
+         */
+        bool Read(TData& element)
+        {
+            const size_t r = this->readIndex.load(std::memory_order_relaxed);
+            if (this->cachedWriteIndex == r && this->ReadAvailable() == 0) return false;
+
+            element = this->pData[r & this->mask];
+            this->readIndex.store(r + 1, std::memory_order_release);
+            return true;
+        }
+
+    protected:
+        /**
+         * Splits a range of the ring into two contiguous spans.
+         *
+         * @param index Unwrapped index of the first element.
+         * @param count Number of elements.
+         */
+        template<typename TViewData>
+        std::pair<BufferView<TViewData>, BufferView<TViewData>> Spans(size_t index, size_t count) const
+        {
+            const size_t start = index & this->mask;
+            const size_t firstCount = std::min(count, this->Capacity() - start);
+
+            return {
+                BufferView<TViewData>(this->pData + start, firstCount, 1),
+                BufferView<TViewData>(this->pData, count - firstCount, 1)
+            };
+        }
+
+        /**
+         * Copies contiguous elements to a view.
+         *
+         * @param pSrc Pointer to the first element.
+         * @param dest The destination, its size is the number of elements to copy.
+         */
+        static void Copy(const TData* pSrc, const view_type& dest)
+        {
+            if (dest.IsContiguous()) (void)std::copy(pSrc, pSrc + dest.Size(), dest.Data());
+            else (void)std::copy(pSrc, pSrc + dest.Size(), dest.begin());
+        }
+    };
+}
+
+#endif
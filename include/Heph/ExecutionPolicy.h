@@ -0,0 +1,67 @@
+#ifndef HEPH_EXECUTION_POLICY_H
+#define HEPH_EXECUTION_POLICY_H
+
+#include "Heph/Utils.h"
+#include <concepts>
+
+/** @file */
+
+namespace Heph
+{
+    /** @brief Specifies that the work is done on the calling thread, in order. */
+    struct SequencedPolicy
+    {
+        /** @brief Whether the work can be split across threads. */
+        static constexpr bool IS_PARALLEL = false;
+    };
+
+    /** @brief Specifies that the work is done on the calling thread and can be vectorized. */
+    struct UnsequencedPolicy
+    {
+        /** @copydoc SequencedPolicy::IS_PARALLEL */
+        static constexpr bool IS_PARALLEL = false;
+    };
+
+    /** @brief Specifies that large amounts of work can be split across the threads of Parallel. */
+    struct ParallelPolicy
+    {
+        /** @copydoc SequencedPolicy::IS_PARALLEL */
+        static constexpr bool IS_PARALLEL = true;
+    };
+
+    /** @brief Specifies that large amounts of work can be split across the threads of Parallel and vectorized. */
+    struct ParallelUnsequencedPolicy
+    {
+        /** @copydoc SequencedPolicy::IS_PARALLEL */
+        static constexpr bool IS_PARALLEL = true;
+    };
+
+    /**
+     * @brief Specifies that ``T`` is one of the execution policies.
+     *
+     * The policies mirror the ones in ``std::execution``. Heph selects the overloads at compile time,
+     * so the sequenced policies neither touch the thread pool nor allocate for the work split.
+     *
+     * @note The arithmetic kernels are vectorized under every policy since element-wise arithmetic has no observable order,
+     * hence the unsequenced policies behave the same as their sequenced counterparts.
+     */
+    template<typename T>
+    concept ExecutionPolicy =
+        std::same_as<T, SequencedPolicy> || std::same_as<T, UnsequencedPolicy> ||
+        std::same_as<T, ParallelPolicy> || std::same_as<T, ParallelUnsequencedPolicy>;
+
+    /** @brief Instances of the execution policies, named after their ``std::execution`` counterparts. */
+    namespace Execution
+    {
+        /** @brief Instance of SequencedPolicy. */
+        inline constexpr SequencedPolicy seq{};
+        /** @brief Instance of UnsequencedPolicy. */
+        inline constexpr UnsequencedPolicy unseq{};
+        /** @brief Instance of ParallelPolicy. */
+        inline constexpr ParallelPolicy par{};
+        /** @brief Instance of ParallelUnsequencedPolicy. */
+        inline constexpr ParallelUnsequencedPolicy par_unseq{};
+    }
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef HEPH_PARALLEL_H
+#define HEPH_PARALLEL_H
+
+#include "Heph/Utils.h"
+#include "Heph/ExecutionPolicy.h"
+#include <functional>
+#include <utility>
+
+/** @file */
+
+namespace Heph
+{
+    /** @brief Provides methods for splitting work across the threads of the default ThreadPool. */
+    class HEPH_API Parallel final
+    {
+    public:
+        HEPH_DISABLE_INSTANCE(Parallel);
+
+        /** Gets the maximum number of threads used by the parallel methods. */
+        static size_t ThreadCount() noexcept;
+
+        /**
+         * Sets the maximum number of threads used by the parallel methods.
+         *
+         * @note The default ThreadPool is created with enough workers for the thread count at the time of its first use,
+         * setting a larger count afterwards does not add workers to it.
+         *
+         * @param threadCount Maximum number of threads, or 0 to use the number of hardware threads.
+         */
+        static void SetThreadCount(size_t threadCount) noexcept;
+
+        /**
+         * Splits the range into contiguous chunks and invokes the function for each chunk in parallel on the default ThreadPool.
+         *
+         * @note The calling thread processes chunks as well, and the chunks are claimed dynamically so the number of invocations may exceed the thread count.
+         * Calls can be nested, a worker that waits for its chunks runs other pending tasks in the meantime.
+         * If the range is not larger than ``grainSize`` or only one thread is available, the function is invoked once on the calling thread.
+         * If any invocation throws, the first exception is rethrown after all chunks are completed.
+         *
+         * @param begin First index of the range.
+         * @param end One past the last index of the range.
+         * @param grainSize Minimum number of indices a chunk must have.
+         * @param func Function that processes the indices in [chunkBegin, chunkEnd).
+         */
+        static void For(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t chunkBegin, size_t chunkEnd)>& func);
+
+        /**
+         * Invokes the function for the range on the calling thread if the policy is sequenced, otherwise calls For.
+         *
+         * @note The sequenced policies do not wrap the function in a ``std::function``, hence they never allocate.
+         *
+         * @param policy Specifies whether the range can be split across threads.
+         * @param begin First index of the range.
+         * @param end One past the last index of the range.
+         * @param grainSize Minimum number of indices a chunk must have.
+         * @param func Function that processes the indices in [chunkBegin, chunkEnd).
+         */
+        template<ExecutionPolicy TPolicy, typename TFunction>
+        static void For([[maybe_unused]] const TPolicy& policy, size_t begin, size_t end, size_t grainSize, TFunction&& func)
+        {
+            if constexpr (TPolicy::IS_PARALLEL)
+            {
+                Parallel::For(begin, end, grainSize, std::function<void(size_t, size_t)>(std::forward<TFunction>(func)));
+            }
+            else
+            {
+                if (begin < end) func(begin, end);
+            }
+        }
+    };
+}
+
+#endif
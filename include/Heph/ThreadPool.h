@@ -0,0 +1,114 @@
+#ifndef HEPH_THREAD_POOL_H
+#define HEPH_THREAD_POOL_H
+
+#include "Heph/Utils.h"
+#include <functional>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/** @file */
+
+namespace Heph
+{
+    /**
+     * @brief Set of persistent worker threads that execute tasks with a work-stealing scheduler.
+     *
+     * Each worker has its own queue. Tasks submitted from a worker are pushed to the queue of that worker, which processes the most recent task first,
+     * while idle workers steal the oldest tasks from the queues of the others.
+     * Tasks submitted from other threads are distributed across the queues in turns.
+     */
+    class HEPH_API ThreadPool final
+    {
+    public:
+        /** @brief A task that can be executed by the pool. */
+        using Task = std::function<void()>;
+
+    private:
+        /** Queue of a worker, the owner pops from the back and thieves steal from the front. */
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+    private:
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::jthread> threads;
+        std::mutex wakeMutex;
+        std::condition_variable wakeCondition;
+        std::atomic<size_t> pendingTaskCount;
+        std::atomic<size_t> nextQueueIndex;
+        bool isStopping;
+
+    public:
+        HEPH_DISABLE_COPY(ThreadPool);
+
+        /**
+         * Creates a pool and starts its workers.
+         *
+         * @param threadCount Number of worker threads. If 0, submitted tasks are executed on the submitting thread.
+         */
+        explicit ThreadPool(size_t threadCount);
+
+        /** Executes the remaining tasks and stops the workers. */
+        ~ThreadPool();
+
+        /** Gets the number of worker threads. */
+        size_t ThreadCount() const noexcept;
+
+        /**
+         * Adds a task to the pool.
+         *
+         * @note Exceptions thrown by the task are not propagated, tasks should handle their own errors.
+         *
+         * @param task The task.
+         */
+        void Submit(Task task);
+
+        /**
+         * Executes one of the pending tasks on the calling thread, preferring the queue of the calling worker.
+         * Threads waiting for tasks of the pool should call this instead of blocking.
+         *
+         * @return ``true`` if a task was executed, ``false`` if there were no pending tasks.
+         */
+        bool RunPendingTask();
+
+        /**
+         * Splits the range into contiguous chunks and invokes the function for each chunk in parallel.
+         *
+         * The range is split into more chunks than threads, and the threads claim them one by one until none remain,
+         * which balances the load when chunks take different amounts of time.
+         *
+         * @note The calling thread processes chunks as well, and runs other pending tasks while it waits for the remaining chunks.
+         * If the range is not larger than ``grainSize`` or ``maxThreadCount`` is 1, the function is invoked once on the calling thread.
+         * If any invocation throws, the first exception is rethrown after all chunks are completed.
+         *
+         * @param begin First index of the range.
+         * @param end One past the last index of the range.
+         * @param grainSize Minimum number of indices a chunk must have.
+         * @param func Function that processes the indices in [chunkBegin, chunkEnd).
+         * @param maxThreadCount Maximum number of threads, including the calling thread, that process the chunks. 0 means the number of workers plus one.
+         */
+        void For(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t chunkBegin, size_t chunkEnd)>& func, size_t maxThreadCount = 0);
+
+        /**
+         * Gets the pool used by Parallel.
+         *
+         * @note The pool is created on first use with enough workers for the larger of Parallel::ThreadCount and the number of hardware threads.
+         */
+        static ThreadPool& Default();
+
+    private:
+        void WorkerLoop(size_t queueIndex);
+        void Push(size_t queueIndex, Task&& task);
+        bool TryPop(size_t queueIndex, Task& task);
+        bool TrySteal(size_t thiefIndex, Task& task);
+    };
+}
+
+#endif
@@ -75,6 +75,18 @@
     #define HEPH_FORCE_INLINE inline
 #endif
 
+/** @brief Allows the member to share its address with other members if it's an empty type. */
+#if defined(_MSC_VER)
+    #define HEPH_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+    #define HEPH_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+/** @brief Size of a cache line in bytes, used for keeping data written by different threads apart. */
+#ifndef HEPH_CACHE_LINE_SIZE
+    #define HEPH_CACHE_LINE_SIZE 64
+#endif
+
 /** Deletes the copy constructor and assignment operator. */
 #define HEPH_DISABLE_COPY(className)    className(const className&) = delete;               \
                                         className& operator=(const className&) = delete
@@ -0,0 +1,76 @@
+#ifndef HEPH_ARITHMETIC_KERNEL_TABLE_H
+#define HEPH_ARITHMETIC_KERNEL_TABLE_H
+
+#include "Heph/Buffers/Kernels/KernelDispatch.h"
+#include "Heph/Buffers/BufferStatistics.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Heph
+{
+    /**
+     * Entry points of the arithmetic kernels for one element type.
+     * Results are stored to ``pDest``, which can be the same as an operand for in-place operations.
+     */
+    template<typename T>
+    struct ArithmeticKernelFunctions
+    {
+        void (*add)(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+        void (*subtract)(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+        void (*multiply)(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+        void (*divide)(T* pDest, const T* pLhs, const T* pRhs, size_t count);
+        void (*addScalar)(T* pDest, const T* pLhs, T rhs, size_t count);
+        void (*subtractScalar)(T* pDest, const T* pLhs, T rhs, size_t count);
+        void (*multiplyScalar)(T* pDest, const T* pLhs, T rhs, size_t count);
+        void (*divideScalar)(T* pDest, const T* pLhs, T rhs, size_t count);
+    };
+
+    /** Entry points of the reduction kernels for one element type. */
+    template<typename T>
+    struct ReductionKernelFunctions
+    {
+        T (*min)(const T* pData, size_t count);
+        T (*max)(const T* pData, size_t count);
+        T (*absMax)(const T* pData, size_t count);
+        double (*sum)(const T* pData, size_t count);
+        double (*sumOfSquares)(const T* pData, size_t count);
+        BufferStatistics<T> (*statistics)(const T* pData, size_t count);
+    };
+
+    /**
+     * Entry points of the arithmetic kernels compiled for one instruction set.
+     * Complex numbers are passed as interleaved (real, imaginary) pairs, ``count`` is the number of complex elements.
+     */
+    struct ArithmeticKernelTable
+    {
+        ArithmeticKernelFunctions<float> f32;
+        ArithmeticKernelFunctions<double> f64;
+        ArithmeticKernelFunctions<int32_t> i32;
+        ArithmeticKernelFunctions<int64_t> i64;
+        void (*complexMultiply)(double* pDest, const double* pLhs, const double* pRhs, size_t count);
+        void (*complexAddScalar)(double* pDest, const double* pLhs, double real, double imag, size_t count);
+        void (*complexSubtractScalar)(double* pDest, const double* pLhs, double real, double imag, size_t count);
+        void (*complexMultiplyScalar)(double* pDest, const double* pLhs, double real, double imag, size_t count);
+        ReductionKernelFunctions<float> f32Reduction;
+        ReductionKernelFunctions<double> f64Reduction;
+        void (*convertF32ToF64)(double* pDest, const float* pSrc, size_t count);
+        void (*convertF64ToF32)(float* pDest, const double* pSrc, size_t count);
+    };
+
+    /** Gets the kernels that use plain loops. */
+    const ArithmeticKernelTable* ArithmeticKernelTableGeneric() noexcept;
+
+    /** Gets the SSE2 kernels, or nullptr if the target does not support them. */
+    const ArithmeticKernelTable* ArithmeticKernelTableSse2() noexcept;
+
+    /** Gets the AVX2 kernels, or nullptr if the target does not support them. */
+    const ArithmeticKernelTable* ArithmeticKernelTableAvx2() noexcept;
+
+    /** Gets the AVX-512 kernels, or nullptr if the target does not support them. */
+    const ArithmeticKernelTable* ArithmeticKernelTableAvx512() noexcept;
+
+    /** Gets the kernels of the active instruction set. */
+    const ArithmeticKernelTable& ActiveArithmeticKernelTable() noexcept;
+}
+
+#endif
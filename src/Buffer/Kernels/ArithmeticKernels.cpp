@@ -0,0 +1,190 @@
+#include "Heph/Buffers/Kernels/ArithmeticKernels.h"
+#include "ArithmeticKernelTable.h"
+
+namespace Heph
+{
+    /** Gets the kernels of the active instruction set for the element type. */
+    template<typename T>
+    static const ArithmeticKernelFunctions<T>& KernelFunctions()
+    {
+        const ArithmeticKernelTable& table = ActiveArithmeticKernelTable();
+        if constexpr (std::is_same_v<T, float>) return table.f32;
+        else if constexpr (std::is_same_v<T, double>) return table.f64;
+        else if constexpr (std::is_same_v<T, int32_t>) return table.i32;
+        else return table.i64;
+    }
+
+    /** Views complex numbers as interleaved (real, imaginary) pairs. */
+    static HEPH_FORCE_INLINE double* Interleaved(std::complex<double>* p)
+    {
+        return reinterpret_cast<double*>(p);
+    }
+
+    /** @copydoc Interleaved */
+    static HEPH_FORCE_INLINE const double* Interleaved(const std::complex<double>* p)
+    {
+        return reinterpret_cast<const double*>(p);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Add(T* pLhs, const T* pRhs, size_t count)
+    {
+        ArithmeticKernels::Add(pLhs, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Add(T* pLhs, const T& rhs, size_t count)
+    {
+        ArithmeticKernels::Add(pLhs, pLhs, rhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Add(T* pDest, const T* pLhs, const T* pRhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>) KernelFunctions<double>().add(Interleaved(pDest), Interleaved(pLhs), Interleaved(pRhs), count * 2);
+        else KernelFunctions<T>().add(pDest, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Add(T* pDest, const T* pLhs, const T& rhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>) ActiveArithmeticKernelTable().complexAddScalar(Interleaved(pDest), Interleaved(pLhs), rhs.real(), rhs.imag(), count);
+        else KernelFunctions<T>().addScalar(pDest, pLhs, rhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Subtract(T* pLhs, const T* pRhs, size_t count)
+    {
+        ArithmeticKernels::Subtract(pLhs, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Subtract(T* pLhs, const T& rhs, size_t count)
+    {
+        ArithmeticKernels::Subtract(pLhs, pLhs, rhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Subtract(T* pDest, const T* pLhs, const T* pRhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>) KernelFunctions<double>().subtract(Interleaved(pDest), Interleaved(pLhs), Interleaved(pRhs), count * 2);
+        else KernelFunctions<T>().subtract(pDest, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Subtract(T* pDest, const T* pLhs, const T& rhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>) ActiveArithmeticKernelTable().complexSubtractScalar(Interleaved(pDest), Interleaved(pLhs), rhs.real(), rhs.imag(), count);
+        else KernelFunctions<T>().subtractScalar(pDest, pLhs, rhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Multiply(T* pLhs, const T* pRhs, size_t count)
+    {
+        ArithmeticKernels::Multiply(pLhs, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Multiply(T* pLhs, const T& rhs, size_t count)
+    {
+        ArithmeticKernels::Multiply(pLhs, pLhs, rhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Multiply(T* pDest, const T* pLhs, const T* pRhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>) ActiveArithmeticKernelTable().complexMultiply(Interleaved(pDest), Interleaved(pLhs), Interleaved(pRhs), count);
+        else KernelFunctions<T>().multiply(pDest, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Multiply(T* pDest, const T* pLhs, const T& rhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>) ActiveArithmeticKernelTable().complexMultiplyScalar(Interleaved(pDest), Interleaved(pLhs), rhs.real(), rhs.imag(), count);
+        else KernelFunctions<T>().multiplyScalar(pDest, pLhs, rhs, count);
+    }
+
+    void ArithmeticKernels::Multiply(std::complex<double>* pLhs, double rhs, size_t count)
+    {
+        KernelFunctions<double>().multiplyScalar(Interleaved(pLhs), Interleaved(pLhs), rhs, count * 2);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Divide(T* pLhs, const T* pRhs, size_t count)
+    {
+        ArithmeticKernels::Divide(pLhs, pLhs, pRhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Divide(T* pLhs, const T& rhs, size_t count)
+    {
+        ArithmeticKernels::Divide(pLhs, pLhs, rhs, count);
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Divide(T* pDest, const T* pLhs, const T* pRhs, size_t count)
+    {
+        // complex division has no vector implementation
+        if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            for (size_t i = 0; i < count; ++i) pDest[i] = pLhs[i] / pRhs[i];
+        }
+        else
+        {
+            KernelFunctions<T>().divide(pDest, pLhs, pRhs, count);
+        }
+    }
+
+    template<ArithmeticKernelElement T>
+    void ArithmeticKernels::Divide(T* pDest, const T* pLhs, const T& rhs, size_t count)
+    {
+        if constexpr (std::is_same_v<T, std::complex<double>>)
+        {
+            const T divisor = rhs;
+            for (size_t i = 0; i < count; ++i) pDest[i] = pLhs[i] / divisor;
+        }
+        else
+        {
+            KernelFunctions<T>().divideScalar(pDest, pLhs, rhs, count);
+        }
+    }
+
+    void ArithmeticKernels::Divide(std::complex<double>* pLhs, double rhs, size_t count)
+    {
+        KernelFunctions<double>().divideScalar(Interleaved(pLhs), Interleaved(pLhs), rhs, count * 2);
+    }
+
+    void ArithmeticKernels::Convert(double* pDest, const float* pSrc, size_t count)
+    {
+        ActiveArithmeticKernelTable().convertF32ToF64(pDest, pSrc, count);
+    }
+
+    void ArithmeticKernels::Convert(float* pDest, const double* pSrc, size_t count)
+    {
+        ActiveArithmeticKernelTable().convertF64ToF32(pDest, pSrc, count);
+    }
+
+#define HEPH_ARITHMETIC_KERNELS_INSTANTIATE(T)                                      \
+    template void ArithmeticKernels::Add<T>(T*, const T*, size_t);                  \
+    template void ArithmeticKernels::Add<T>(T*, const T&, size_t);                  \
+    template void ArithmeticKernels::Add<T>(T*, const T*, const T*, size_t);        \
+    template void ArithmeticKernels::Add<T>(T*, const T*, const T&, size_t);        \
+    template void ArithmeticKernels::Subtract<T>(T*, const T*, size_t);             \
+    template void ArithmeticKernels::Subtract<T>(T*, const T&, size_t);             \
+    template void ArithmeticKernels::Subtract<T>(T*, const T*, const T*, size_t);   \
+    template void ArithmeticKernels::Subtract<T>(T*, const T*, const T&, size_t);   \
+    template void ArithmeticKernels::Multiply<T>(T*, const T*, size_t);             \
+    template void ArithmeticKernels::Multiply<T>(T*, const T&, size_t);             \
+    template void ArithmeticKernels::Multiply<T>(T*, const T*, const T*, size_t);   \
+    template void ArithmeticKernels::Multiply<T>(T*, const T*, const T&, size_t);   \
+    template void ArithmeticKernels::Divide<T>(T*, const T*, size_t);               \
+    template void ArithmeticKernels::Divide<T>(T*, const T&, size_t);               \
+    template void ArithmeticKernels::Divide<T>(T*, const T*, const T*, size_t);     \
+    template void ArithmeticKernels::Divide<T>(T*, const T*, const T&, size_t)
+
+    HEPH_ARITHMETIC_KERNELS_INSTANTIATE(float);
+    HEPH_ARITHMETIC_KERNELS_INSTANTIATE(double);
+    HEPH_ARITHMETIC_KERNELS_INSTANTIATE(int32_t);
+    HEPH_ARITHMETIC_KERNELS_INSTANTIATE(int64_t);
+    HEPH_ARITHMETIC_KERNELS_INSTANTIATE(std::complex<double>);
+}
@@ -0,0 +1,41 @@
+#include "ArithmeticKernelTable.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+
+#define HEPH_KERNELS_AVX512
+#include "ArithmeticKernelsImpl.h"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+namespace Heph
+{
+    const ArithmeticKernelTable* ArithmeticKernelTableAvx512() noexcept
+    {
+        return &ARITHMETIC_KERNEL_TABLE;
+    }
+}
+
+#else
+
+namespace Heph
+{
+    const ArithmeticKernelTable* ArithmeticKernelTableAvx512() noexcept
+    {
+        return nullptr;
+    }
+}
+
+#endif
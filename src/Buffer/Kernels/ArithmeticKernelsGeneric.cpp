@@ -0,0 +1,9 @@
+#include "ArithmeticKernelsImpl.h"
+
+namespace Heph
+{
+    const ArithmeticKernelTable* ArithmeticKernelTableGeneric() noexcept
+    {
+        return &ARITHMETIC_KERNEL_TABLE;
+    }
+}
@@ -0,0 +1,846 @@
+// Implementation of the arithmetic kernels, included once per instruction set.
+// The including file defines one of HEPH_KERNELS_AVX512, HEPH_KERNELS_AVX2 or HEPH_KERNELS_SSE2 (or none for plain loops)
+// and enables the instruction set for the code that follows, e.g. with "#pragma GCC target".
+// Everything is in an anonymous namespace so that the copies compiled for different instruction sets do not collide,
+// and no standard library templates are used so that the linker never picks code compiled for a wider instruction set.
+
+#include "ArithmeticKernelTable.h"
+#include <cfloat>
+
+namespace Heph
+{
+    namespace
+    {
+        /** Element-wise operations the kernels implement. */
+        enum class KernelOperation
+        {
+            Add,
+            Subtract,
+            Multiply,
+            Divide
+        };
+
+        /**
+         * Wrapper around the vector registers of an instruction set.
+         * The primary template is used for the types and targets without vector support, each element is processed separately.
+         */
+        template<typename T>
+        struct KernelVector
+        {
+            static constexpr size_t WIDTH = 1;
+            static constexpr bool HAS_MULTIPLY = false;
+            static constexpr bool HAS_DIVIDE = false;
+        };
+
+    #if defined(HEPH_KERNELS_AVX512)
+
+        template<>
+        struct KernelVector<float>
+        {
+            using type = __m512;
+            static constexpr size_t WIDTH = 16;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = true;
+
+            static HEPH_FORCE_INLINE type Load(const float* p) { return _mm512_loadu_ps(p); }
+            static HEPH_FORCE_INLINE void Store(float* p, type v) { _mm512_storeu_ps(p, v); }
+            static HEPH_FORCE_INLINE type Set(float x) { return _mm512_set1_ps(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm512_add_ps(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm512_sub_ps(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm512_mul_ps(a, b); }
+            static HEPH_FORCE_INLINE type Divide(type a, type b) { return _mm512_div_ps(a, b); }
+            static HEPH_FORCE_INLINE type Min(type a, type b) { return _mm512_min_ps(a, b); }
+            static HEPH_FORCE_INLINE type Max(type a, type b) { return _mm512_max_ps(a, b); }
+            static HEPH_FORCE_INLINE type Abs(type a) { return _mm512_abs_ps(a); }
+        };
+
+        template<>
+        struct KernelVector<double>
+        {
+            using type = __m512d;
+            static constexpr size_t WIDTH = 8;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = true;
+
+            static HEPH_FORCE_INLINE type Load(const double* p) { return _mm512_loadu_pd(p); }
+            static HEPH_FORCE_INLINE void Store(double* p, type v) { _mm512_storeu_pd(p, v); }
+            static HEPH_FORCE_INLINE type Set(double x) { return _mm512_set1_pd(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm512_add_pd(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm512_sub_pd(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm512_mul_pd(a, b); }
+            static HEPH_FORCE_INLINE type Divide(type a, type b) { return _mm512_div_pd(a, b); }
+            static HEPH_FORCE_INLINE type Min(type a, type b) { return _mm512_min_pd(a, b); }
+            static HEPH_FORCE_INLINE type Max(type a, type b) { return _mm512_max_pd(a, b); }
+            static HEPH_FORCE_INLINE type Abs(type a) { return _mm512_abs_pd(a); }
+
+            /** Loads WIDTH floats and converts them to double. */
+            static HEPH_FORCE_INLINE type Load(const float* p) { return _mm512_cvtps_pd(_mm256_loadu_ps(p)); }
+
+            /** Converts the elements to float and stores WIDTH floats. */
+            static HEPH_FORCE_INLINE void Store(float* p, type v) { _mm256_storeu_ps(p, _mm512_cvtpd_ps(v)); }
+
+            /** Multiplies the interleaved (real, imaginary) pairs. */
+            static HEPH_FORCE_INLINE type ComplexMultiply(type a, type b)
+            {
+                const type bReal = _mm512_movedup_pd(b);
+                const type bImag = _mm512_permute_pd(b, 0xFF);
+                const type aSwapped = _mm512_permute_pd(a, 0x55);
+                return _mm512_fmaddsub_pd(a, bReal, _mm512_mul_pd(aSwapped, bImag));
+            }
+        };
+
+        template<>
+        struct KernelVector<int32_t>
+        {
+            using type = __m512i;
+            static constexpr size_t WIDTH = 16;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = false;
+
+            static HEPH_FORCE_INLINE type Load(const int32_t* p) { return _mm512_loadu_si512(p); }
+            static HEPH_FORCE_INLINE void Store(int32_t* p, type v) { _mm512_storeu_si512(p, v); }
+            static HEPH_FORCE_INLINE type Set(int32_t x) { return _mm512_set1_epi32(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm512_add_epi32(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm512_sub_epi32(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm512_mullo_epi32(a, b); }
+        };
+
+        template<>
+        struct KernelVector<int64_t>
+        {
+            using type = __m512i;
+            static constexpr size_t WIDTH = 8;
+            static constexpr bool HAS_MULTIPLY = false;
+            static constexpr bool HAS_DIVIDE = false;
+
+            static HEPH_FORCE_INLINE type Load(const int64_t* p) { return _mm512_loadu_si512(p); }
+            static HEPH_FORCE_INLINE void Store(int64_t* p, type v) { _mm512_storeu_si512(p, v); }
+            static HEPH_FORCE_INLINE type Set(int64_t x) { return _mm512_set1_epi64(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm512_add_epi64(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm512_sub_epi64(a, b); }
+        };
+
+    #elif defined(HEPH_KERNELS_AVX2)
+
+        template<>
+        struct KernelVector<float>
+        {
+            using type = __m256;
+            static constexpr size_t WIDTH = 8;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = true;
+
+            static HEPH_FORCE_INLINE type Load(const float* p) { return _mm256_loadu_ps(p); }
+            static HEPH_FORCE_INLINE void Store(float* p, type v) { _mm256_storeu_ps(p, v); }
+            static HEPH_FORCE_INLINE type Set(float x) { return _mm256_set1_ps(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm256_add_ps(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm256_sub_ps(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm256_mul_ps(a, b); }
+            static HEPH_FORCE_INLINE type Divide(type a, type b) { return _mm256_div_ps(a, b); }
+            static HEPH_FORCE_INLINE type Min(type a, type b) { return _mm256_min_ps(a, b); }
+            static HEPH_FORCE_INLINE type Max(type a, type b) { return _mm256_max_ps(a, b); }
+            static HEPH_FORCE_INLINE type Abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+        };
+
+        template<>
+        struct KernelVector<double>
+        {
+            using type = __m256d;
+            static constexpr size_t WIDTH = 4;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = true;
+
+            static HEPH_FORCE_INLINE type Load(const double* p) { return _mm256_loadu_pd(p); }
+            static HEPH_FORCE_INLINE void Store(double* p, type v) { _mm256_storeu_pd(p, v); }
+            static HEPH_FORCE_INLINE type Set(double x) { return _mm256_set1_pd(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm256_add_pd(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm256_sub_pd(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm256_mul_pd(a, b); }
+            static HEPH_FORCE_INLINE type Divide(type a, type b) { return _mm256_div_pd(a, b); }
+            static HEPH_FORCE_INLINE type Min(type a, type b) { return _mm256_min_pd(a, b); }
+            static HEPH_FORCE_INLINE type Max(type a, type b) { return _mm256_max_pd(a, b); }
+            static HEPH_FORCE_INLINE type Abs(type a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+
+            /** @copydoc KernelVector<double>::Load(const float*) */
+            static HEPH_FORCE_INLINE type Load(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+
+            /** @copydoc KernelVector<double>::Store(float*, type) */
+            static HEPH_FORCE_INLINE void Store(float* p, type v) { _mm_storeu_ps(p, _mm256_cvtpd_ps(v)); }
+
+            /** @copydoc KernelVector<double>::ComplexMultiply */
+            static HEPH_FORCE_INLINE type ComplexMultiply(type a, type b)
+            {
+                const type bReal = _mm256_movedup_pd(b);
+                const type bImag = _mm256_permute_pd(b, 0xF);
+                const type aSwapped = _mm256_permute_pd(a, 0x5);
+                return _mm256_addsub_pd(_mm256_mul_pd(a, bReal), _mm256_mul_pd(aSwapped, bImag));
+            }
+        };
+
+        template<>
+        struct KernelVector<int32_t>
+        {
+            using type = __m256i;
+            static constexpr size_t WIDTH = 8;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = false;
+
+            static HEPH_FORCE_INLINE type Load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static HEPH_FORCE_INLINE void Store(int32_t* p, type v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+            static HEPH_FORCE_INLINE type Set(int32_t x) { return _mm256_set1_epi32(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm256_add_epi32(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm256_sub_epi32(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm256_mullo_epi32(a, b); }
+        };
+
+        template<>
+        struct KernelVector<int64_t>
+        {
+            using type = __m256i;
+            static constexpr size_t WIDTH = 4;
+            static constexpr bool HAS_MULTIPLY = false;
+            static constexpr bool HAS_DIVIDE = false;
+
+            static HEPH_FORCE_INLINE type Load(const int64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+            static HEPH_FORCE_INLINE void Store(int64_t* p, type v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+            static HEPH_FORCE_INLINE type Set(int64_t x) { return _mm256_set1_epi64x(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm256_add_epi64(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm256_sub_epi64(a, b); }
+        };
+
+    #elif defined(HEPH_KERNELS_SSE2)
+
+        template<>
+        struct KernelVector<float>
+        {
+            using type = __m128;
+            static constexpr size_t WIDTH = 4;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = true;
+
+            static HEPH_FORCE_INLINE type Load(const float* p) { return _mm_loadu_ps(p); }
+            static HEPH_FORCE_INLINE void Store(float* p, type v) { _mm_storeu_ps(p, v); }
+            static HEPH_FORCE_INLINE type Set(float x) { return _mm_set1_ps(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm_add_ps(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm_sub_ps(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm_mul_ps(a, b); }
+            static HEPH_FORCE_INLINE type Divide(type a, type b) { return _mm_div_ps(a, b); }
+            static HEPH_FORCE_INLINE type Min(type a, type b) { return _mm_min_ps(a, b); }
+            static HEPH_FORCE_INLINE type Max(type a, type b) { return _mm_max_ps(a, b); }
+            static HEPH_FORCE_INLINE type Abs(type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+        };
+
+        template<>
+        struct KernelVector<double>
+        {
+            using type = __m128d;
+            static constexpr size_t WIDTH = 2;
+            static constexpr bool HAS_MULTIPLY = true;
+            static constexpr bool HAS_DIVIDE = true;
+
+            static HEPH_FORCE_INLINE type Load(const double* p) { return _mm_loadu_pd(p); }
+            static HEPH_FORCE_INLINE void Store(double* p, type v) { _mm_storeu_pd(p, v); }
+            static HEPH_FORCE_INLINE type Set(double x) { return _mm_set1_pd(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm_add_pd(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm_sub_pd(a, b); }
+            static HEPH_FORCE_INLINE type Multiply(type a, type b) { return _mm_mul_pd(a, b); }
+            static HEPH_FORCE_INLINE type Divide(type a, type b) { return _mm_div_pd(a, b); }
+            static HEPH_FORCE_INLINE type Min(type a, type b) { return _mm_min_pd(a, b); }
+            static HEPH_FORCE_INLINE type Max(type a, type b) { return _mm_max_pd(a, b); }
+            static HEPH_FORCE_INLINE type Abs(type a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+
+            /** @copydoc KernelVector<double>::Load(const float*) */
+            static HEPH_FORCE_INLINE type Load(const float* p) { return _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p)))); }
+
+            /** @copydoc KernelVector<double>::Store(float*, type) */
+            static HEPH_FORCE_INLINE void Store(float* p, type v) { _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(_mm_cvtpd_ps(v))); }
+
+            /** @copydoc KernelVector<double>::ComplexMultiply */
+            static HEPH_FORCE_INLINE type ComplexMultiply(type a, type b)
+            {
+                const type bReal = _mm_unpacklo_pd(b, b);
+                const type bImag = _mm_unpackhi_pd(b, b);
+                const type aSwapped = _mm_shuffle_pd(a, a, 0x1);
+                const type negateReal = _mm_set_pd(0.0, -0.0);
+                return _mm_add_pd(_mm_mul_pd(a, bReal), _mm_xor_pd(_mm_mul_pd(aSwapped, bImag), negateReal));
+            }
+        };
+
+        template<>
+        struct KernelVector<int32_t>
+        {
+            using type = __m128i;
+            static constexpr size_t WIDTH = 4;
+            static constexpr bool HAS_MULTIPLY = false;
+            static constexpr bool HAS_DIVIDE = false;
+
+            static HEPH_FORCE_INLINE type Load(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static HEPH_FORCE_INLINE void Store(int32_t* p, type v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static HEPH_FORCE_INLINE type Set(int32_t x) { return _mm_set1_epi32(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm_add_epi32(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm_sub_epi32(a, b); }
+        };
+
+        template<>
+        struct KernelVector<int64_t>
+        {
+            using type = __m128i;
+            static constexpr size_t WIDTH = 2;
+            static constexpr bool HAS_MULTIPLY = false;
+            static constexpr bool HAS_DIVIDE = false;
+
+            static HEPH_FORCE_INLINE type Load(const int64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static HEPH_FORCE_INLINE void Store(int64_t* p, type v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+            static HEPH_FORCE_INLINE type Set(int64_t x) { return _mm_set1_epi64x(x); }
+            static HEPH_FORCE_INLINE type Add(type a, type b) { return _mm_add_epi64(a, b); }
+            static HEPH_FORCE_INLINE type Subtract(type a, type b) { return _mm_sub_epi64(a, b); }
+        };
+
+    #endif
+
+        /** Checks whether the operation has vector instructions for the type. */
+        template<KernelOperation Op, typename T>
+        static constexpr bool IsVectorized()
+        {
+            using vector_t = KernelVector<T>;
+            if constexpr (vector_t::WIDTH == 1) return false;
+            else if constexpr (Op == KernelOperation::Multiply) return vector_t::HAS_MULTIPLY;
+            else if constexpr (Op == KernelOperation::Divide) return vector_t::HAS_DIVIDE;
+            else return true;
+        }
+
+        /** Applies the operation to vector registers. */
+        template<KernelOperation Op, typename TVector>
+        static HEPH_FORCE_INLINE typename TVector::type ApplyVector(typename TVector::type a, typename TVector::type b)
+        {
+            if constexpr (Op == KernelOperation::Add) return TVector::Add(a, b);
+            else if constexpr (Op == KernelOperation::Subtract) return TVector::Subtract(a, b);
+            else if constexpr (Op == KernelOperation::Multiply) return TVector::Multiply(a, b);
+            else return TVector::Divide(a, b);
+        }
+
+        /** Applies the operation to a single element. */
+        template<KernelOperation Op, typename T>
+        static HEPH_FORCE_INLINE void ApplyElement(T& lhs, const T& rhs)
+        {
+            if constexpr (Op == KernelOperation::Add) lhs += rhs;
+            else if constexpr (Op == KernelOperation::Subtract) lhs -= rhs;
+            else if constexpr (Op == KernelOperation::Multiply) lhs *= rhs;
+            else lhs /= rhs;
+        }
+
+        /** Checks whether the arrays share memory without being the same array, vectorizing such operations changes the results. */
+        template<typename T>
+        static bool PartiallyOverlaps(const T* pLhs, const T* pRhs, size_t count)
+        {
+            const uintptr_t lhs = reinterpret_cast<uintptr_t>(pLhs);
+            const uintptr_t rhs = reinterpret_cast<uintptr_t>(pRhs);
+            const uintptr_t size = count * sizeof(T);
+            return lhs != rhs && lhs < rhs + size && rhs < lhs + size;
+        }
+
+        /** Applies the operation to the elements of two arrays and stores the results to the destination. */
+        template<KernelOperation Op, typename T>
+        static void ApplyArray(T* pDest, const T* pLhs, const T* pRhs, size_t count)
+        {
+            size_t i = 0;
+
+            if constexpr (IsVectorized<Op, T>())
+            {
+                using vector_t = KernelVector<T>;
+                constexpr size_t width = vector_t::WIDTH;
+
+                if (!PartiallyOverlaps(pDest, pLhs, count) && !PartiallyOverlaps(pDest, pRhs, count))
+                {
+                    for (; i + 2 * width <= count; i += 2 * width)
+                    {
+                        const typename vector_t::type r0 = ApplyVector<Op, vector_t>(vector_t::Load(pLhs + i), vector_t::Load(pRhs + i));
+                        const typename vector_t::type r1 = ApplyVector<Op, vector_t>(vector_t::Load(pLhs + i + width), vector_t::Load(pRhs + i + width));
+                        vector_t::Store(pDest + i, r0);
+                        vector_t::Store(pDest + i + width, r1);
+                    }
+
+                    for (; i + width <= count; i += width)
+                        vector_t::Store(pDest + i, ApplyVector<Op, vector_t>(vector_t::Load(pLhs + i), vector_t::Load(pRhs + i)));
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                T result = pLhs[i];
+                ApplyElement<Op>(result, pRhs[i]);
+                pDest[i] = result;
+            }
+        }
+
+        /** Applies the operation to the elements of an array and a constant, and stores the results to the destination. */
+        template<KernelOperation Op, typename T>
+        static void ApplyScalar(T* pDest, const T* pLhs, T rhs, size_t count)
+        {
+            size_t i = 0;
+
+            if constexpr (IsVectorized<Op, T>())
+            {
+                using vector_t = KernelVector<T>;
+                constexpr size_t width = vector_t::WIDTH;
+                const typename vector_t::type vRhs = vector_t::Set(rhs);
+
+                if (!PartiallyOverlaps(pDest, pLhs, count))
+                {
+                    for (; i + 2 * width <= count; i += 2 * width)
+                    {
+                        vector_t::Store(pDest + i, ApplyVector<Op, vector_t>(vector_t::Load(pLhs + i), vRhs));
+                        vector_t::Store(pDest + i + width, ApplyVector<Op, vector_t>(vector_t::Load(pLhs + i + width), vRhs));
+                    }
+
+                    for (; i + width <= count; i += width)
+                        vector_t::Store(pDest + i, ApplyVector<Op, vector_t>(vector_t::Load(pLhs + i), vRhs));
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                T result = pLhs[i];
+                ApplyElement<Op>(result, rhs);
+                pDest[i] = result;
+            }
+        }
+
+        /** Multiplies two interleaved complex numbers without the C99 Annex G rules, same as the vector instructions. */
+        static HEPH_FORCE_INLINE void ComplexMultiplyElement(double* pDest, const double* pLhs, double real, double imag)
+        {
+            const double lhsReal = pLhs[0];
+            const double lhsImag = pLhs[1];
+            pDest[0] = lhsReal * real - lhsImag * imag;
+            pDest[1] = lhsReal * imag + lhsImag * real;
+        }
+
+        /** Multiplies the elements of two interleaved complex arrays and stores the results to the destination. */
+        template<typename TVector = KernelVector<double>>
+        static void ComplexMultiplyArray(double* pDest, const double* pLhs, const double* pRhs, size_t count)
+        {
+            size_t i = 0;
+
+            if constexpr (TVector::WIDTH > 1)
+            {
+                using vector_t = TVector;
+                constexpr size_t width = vector_t::WIDTH / 2;
+
+                if (!PartiallyOverlaps(pDest, pLhs, count * 2) && !PartiallyOverlaps(pDest, pRhs, count * 2))
+                {
+                    for (; i + width <= count; i += width)
+                        vector_t::Store(pDest + i * 2, vector_t::ComplexMultiply(vector_t::Load(pLhs + i * 2), vector_t::Load(pRhs + i * 2)));
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                const double rhsReal = pRhs[i * 2];
+                const double rhsImag = pRhs[i * 2 + 1];
+                ComplexMultiplyElement(pDest + i * 2, pLhs + i * 2, rhsReal, rhsImag);
+            }
+        }
+
+        /** Applies the operation to the elements of an interleaved complex array and a complex constant, and stores the results to the destination. */
+        template<KernelOperation Op, typename TVector = KernelVector<double>>
+        static void ComplexApplyScalar(double* pDest, const double* pLhs, double real, double imag, size_t count)
+        {
+            size_t i = 0;
+
+            if constexpr (TVector::WIDTH > 1)
+            {
+                using vector_t = TVector;
+                constexpr size_t width = vector_t::WIDTH / 2;
+
+                double pattern[vector_t::WIDTH];
+                for (size_t j = 0; j < vector_t::WIDTH; j += 2)
+                {
+                    pattern[j] = real;
+                    pattern[j + 1] = imag;
+                }
+                const typename vector_t::type vRhs = vector_t::Load(pattern);
+
+                if (!PartiallyOverlaps(pDest, pLhs, count * 2))
+                {
+                    for (; i + width <= count; i += width)
+                    {
+                        const typename vector_t::type vLhs = vector_t::Load(pLhs + i * 2);
+                        if constexpr (Op == KernelOperation::Multiply) vector_t::Store(pDest + i * 2, vector_t::ComplexMultiply(vLhs, vRhs));
+                        else vector_t::Store(pDest + i * 2, ApplyVector<Op, vector_t>(vLhs, vRhs));
+                    }
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                if constexpr (Op == KernelOperation::Multiply)
+                {
+                    ComplexMultiplyElement(pDest + i * 2, pLhs + i * 2, real, imag);
+                }
+                else
+                {
+                    double resultReal = pLhs[i * 2];
+                    double resultImag = pLhs[i * 2 + 1];
+                    ApplyElement<Op>(resultReal, real);
+                    ApplyElement<Op>(resultImag, imag);
+                    pDest[i * 2] = resultReal;
+                    pDest[i * 2 + 1] = resultImag;
+                }
+            }
+        }
+
+        /** Reductions the kernels implement. */
+        enum class ReductionOperation
+        {
+            Min,
+            Max,
+            AbsMax
+        };
+
+        /**
+         * Folds an element into the result of a reduction.
+         * NaN elements are skipped, which is also what the min and max instructions do when the element is the first operand.
+         */
+        template<ReductionOperation Op, typename T>
+        static HEPH_FORCE_INLINE void ReduceElement(T& result, T element)
+        {
+            if constexpr (Op == ReductionOperation::Min)
+            {
+                if (element < result) result = element;
+            }
+            else
+            {
+                if constexpr (Op == ReductionOperation::AbsMax) element = (element < 0) ? -element : element;
+                if (element > result) result = element;
+            }
+        }
+
+        /** Folds a vector of elements into the vector of results of a reduction. */
+        template<ReductionOperation Op, typename TVector>
+        static HEPH_FORCE_INLINE typename TVector::type ReduceVector(typename TVector::type result, typename TVector::type elements)
+        {
+            if constexpr (Op == ReductionOperation::Min) return TVector::Min(elements, result);
+            else if constexpr (Op == ReductionOperation::Max) return TVector::Max(elements, result);
+            else return TVector::Max(TVector::Abs(elements), result);
+        }
+
+        /** Gets the value the reduction starts with, also returned for empty arrays. */
+        template<ReductionOperation Op, typename T>
+        static constexpr T ReductionIdentity()
+        {
+            constexpr T max = (sizeof(T) == sizeof(float)) ? static_cast<T>(FLT_MAX) : static_cast<T>(DBL_MAX);
+            return (Op == ReductionOperation::Min) ? max : -max;
+        }
+
+        /**
+         * Finds the minimum, maximum, or maximum absolute value of an array.
+         * Four independent accumulators are used to hide the latency of the min and max instructions.
+         */
+        template<ReductionOperation Op, typename T, typename TVector = KernelVector<T>>
+        static T Reduce(const T* pData, size_t count)
+        {
+            T result = ReductionIdentity<Op, T>();
+            size_t i = 0;
+
+            if constexpr (TVector::WIDTH > 1)
+            {
+                using vector_t = TVector;
+                constexpr size_t width = vector_t::WIDTH;
+
+                if (count >= width)
+                {
+                    typename vector_t::type r0 = vector_t::Set(result);
+                    typename vector_t::type r1 = r0;
+                    typename vector_t::type r2 = r0;
+                    typename vector_t::type r3 = r0;
+
+                    for (; i + 4 * width <= count; i += 4 * width)
+                    {
+                        r0 = ReduceVector<Op, vector_t>(r0, vector_t::Load(pData + i));
+                        r1 = ReduceVector<Op, vector_t>(r1, vector_t::Load(pData + i + width));
+                        r2 = ReduceVector<Op, vector_t>(r2, vector_t::Load(pData + i + 2 * width));
+                        r3 = ReduceVector<Op, vector_t>(r3, vector_t::Load(pData + i + 3 * width));
+                    }
+
+                    for (; i + width <= count; i += width)
+                        r0 = ReduceVector<Op, vector_t>(r0, vector_t::Load(pData + i));
+
+                    // the accumulators hold no NaN, so the order they are combined in does not matter
+                    r0 = (Op == ReductionOperation::Min) ? vector_t::Min(r0, vector_t::Min(r1, vector_t::Min(r2, r3))) : vector_t::Max(r0, vector_t::Max(r1, vector_t::Max(r2, r3)));
+
+                    T lanes[width];
+                    vector_t::Store(lanes, r0);
+                    for (size_t j = 0; j < width; ++j)
+                    {
+                        if constexpr (Op == ReductionOperation::Min) ReduceElement<Op>(result, lanes[j]);
+                        else ReduceElement<ReductionOperation::Max>(result, lanes[j]);
+                    }
+                }
+            }
+
+            for (; i < count; ++i) ReduceElement<Op>(result, pData[i]);
+            return result;
+        }
+
+        /** Adds a value to a sum with Kahan compensation. */
+        static HEPH_FORCE_INLINE void KahanAdd(double& sum, double& compensation, double value)
+        {
+            const double y = value - compensation;
+            const double t = sum + y;
+            compensation = (t - sum) - y;
+            sum = t;
+        }
+
+        /**
+         * Calculates the sum of the squares of the elements in double precision.
+         * Each vector lane keeps its own Kahan-compensated sum, two sets of lanes are used to hide the latency of the additions.
+         */
+        template<typename T, typename TVector = KernelVector<double>>
+        static double SumOfSquares(const T* pData, size_t count)
+        {
+            double sum = 0;
+            double compensation = 0;
+            size_t i = 0;
+
+            if constexpr (TVector::WIDTH > 1)
+            {
+                using vector_t = TVector;
+                using type = typename vector_t::type;
+                constexpr size_t width = vector_t::WIDTH;
+
+                if (count >= width)
+                {
+                    type s0 = vector_t::Set(0), c0 = s0, s1 = s0, c1 = s0;
+
+                    for (; i + 2 * width <= count; i += 2 * width)
+                    {
+                        const type x0 = vector_t::Load(pData + i);
+                        const type x1 = vector_t::Load(pData + i + width);
+
+                        const type y0 = vector_t::Subtract(vector_t::Multiply(x0, x0), c0);
+                        const type y1 = vector_t::Subtract(vector_t::Multiply(x1, x1), c1);
+                        const type t0 = vector_t::Add(s0, y0);
+                        const type t1 = vector_t::Add(s1, y1);
+                        c0 = vector_t::Subtract(vector_t::Subtract(t0, s0), y0);
+                        c1 = vector_t::Subtract(vector_t::Subtract(t1, s1), y1);
+                        s0 = t0;
+                        s1 = t1;
+                    }
+
+                    for (; i + width <= count; i += width)
+                    {
+                        const type x0 = vector_t::Load(pData + i);
+                        const type y0 = vector_t::Subtract(vector_t::Multiply(x0, x0), c0);
+                        const type t0 = vector_t::Add(s0, y0);
+                        c0 = vector_t::Subtract(vector_t::Subtract(t0, s0), y0);
+                        s0 = t0;
+                    }
+
+                    double lanes[4][width];
+                    vector_t::Store(lanes[0], s0);
+                    vector_t::Store(lanes[1], s1);
+                    vector_t::Store(lanes[2], c0);
+                    vector_t::Store(lanes[3], c1);
+                    for (size_t j = 0; j < width; ++j)
+                    {
+                        KahanAdd(sum, compensation, lanes[0][j]);
+                        KahanAdd(sum, compensation, lanes[1][j]);
+                        KahanAdd(sum, compensation, -lanes[2][j]);
+                        KahanAdd(sum, compensation, -lanes[3][j]);
+                    }
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                const double x = pData[i];
+                KahanAdd(sum, compensation, x * x);
+            }
+            return sum;
+        }
+
+        /** Calculates the sum of the elements in double precision, two sets of lanes are used to hide the latency of the additions. */
+        template<typename T, typename TVector = KernelVector<double>>
+        static double Sum(const T* pData, size_t count)
+        {
+            double sum = 0;
+            size_t i = 0;
+
+            if constexpr (TVector::WIDTH > 1)
+            {
+                using vector_t = TVector;
+                using type = typename vector_t::type;
+                constexpr size_t width = vector_t::WIDTH;
+
+                type s0 = vector_t::Set(0), s1 = s0;
+                for (; i + 2 * width <= count; i += 2 * width)
+                {
+                    s0 = vector_t::Add(s0, vector_t::Load(pData + i));
+                    s1 = vector_t::Add(s1, vector_t::Load(pData + i + width));
+                }
+                for (; i + width <= count; i += width)
+                    s0 = vector_t::Add(s0, vector_t::Load(pData + i));
+
+                double lanes[width];
+                vector_t::Store(lanes, vector_t::Add(s0, s1));
+                for (size_t j = 0; j < width; ++j) sum += lanes[j];
+            }
+
+            for (; i < count; ++i) sum += pData[i];
+            return sum;
+        }
+
+        /** Calculates the sum of the squared differences from the mean and the sum of the squares of the elements. */
+        template<typename T, typename TVector = KernelVector<double>>
+        static void SumOfSquaredDeviations(const T* pData, size_t count, double mean, double& sumOfSquaredDeviations, double& sumOfSquares)
+        {
+            sumOfSquaredDeviations = 0;
+            sumOfSquares = 0;
+            size_t i = 0;
+
+            if constexpr (TVector::WIDTH > 1)
+            {
+                using vector_t = TVector;
+                using type = typename vector_t::type;
+                constexpr size_t width = vector_t::WIDTH;
+
+                const type vMean = vector_t::Set(mean);
+                type d0 = vector_t::Set(0), d1 = d0, q0 = d0, q1 = d0;
+                for (; i + 2 * width <= count; i += 2 * width)
+                {
+                    const type x0 = vector_t::Load(pData + i);
+                    const type x1 = vector_t::Load(pData + i + width);
+                    const type e0 = vector_t::Subtract(x0, vMean);
+                    const type e1 = vector_t::Subtract(x1, vMean);
+                    d0 = vector_t::Add(d0, vector_t::Multiply(e0, e0));
+                    d1 = vector_t::Add(d1, vector_t::Multiply(e1, e1));
+                    q0 = vector_t::Add(q0, vector_t::Multiply(x0, x0));
+                    q1 = vector_t::Add(q1, vector_t::Multiply(x1, x1));
+                }
+                for (; i + width <= count; i += width)
+                {
+                    const type x0 = vector_t::Load(pData + i);
+                    const type e0 = vector_t::Subtract(x0, vMean);
+                    d0 = vector_t::Add(d0, vector_t::Multiply(e0, e0));
+                    q0 = vector_t::Add(q0, vector_t::Multiply(x0, x0));
+                }
+
+                double lanes[2][width];
+                vector_t::Store(lanes[0], vector_t::Add(d0, d1));
+                vector_t::Store(lanes[1], vector_t::Add(q0, q1));
+                for (size_t j = 0; j < width; ++j)
+                {
+                    sumOfSquaredDeviations += lanes[0][j];
+                    sumOfSquares += lanes[1][j];
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                const double x = pData[i];
+                sumOfSquaredDeviations += (x - mean) * (x - mean);
+                sumOfSquares += x * x;
+            }
+        }
+
+        /** Number of elements the statistics kernel processes at once, small enough for the second pass over them to hit the L1 cache. */
+        constexpr size_t STATISTICS_BLOCK_SIZE = 1024;
+
+        /**
+         * Calculates the statistics of an array.
+         * Each block is reduced with two passes, which read the memory once and give an exact mean for the squared deviations,
+         * and the blocks are combined with BufferStatistics::Merge.
+         */
+        template<typename T>
+        static BufferStatistics<T> Statistics(const T* pData, size_t count)
+        {
+            BufferStatistics<T> result;
+
+            for (size_t i = 0; i < count; i += STATISTICS_BLOCK_SIZE)
+            {
+                const T* pBlock = pData + i;
+                const size_t blockCount = (count - i < STATISTICS_BLOCK_SIZE) ? (count - i) : STATISTICS_BLOCK_SIZE;
+
+                BufferStatistics<T> block;
+                block.count = blockCount;
+                block.min = Reduce<ReductionOperation::Min>(pBlock, blockCount);
+                block.max = Reduce<ReductionOperation::Max>(pBlock, blockCount);
+                block.absMax = (-block.min > block.max) ? -block.min : block.max;
+                block.sum = Sum(pBlock, blockCount);
+                block.mean = block.sum / static_cast<double>(blockCount);
+                SumOfSquaredDeviations(pBlock, blockCount, block.mean, block.sumOfSquaredDeviations, block.sumOfSquares);
+
+                result.Merge(block);
+            }
+
+            return result;
+        }
+
+        /**
+         * Converts the elements of an array between float and double.
+         * Both directions use the double vectors, which load floats and store them as floats with conversion.
+         */
+        template<typename TDest, typename TSrc, typename TVector = KernelVector<double>>
+        static void Convert(TDest* pDest, const TSrc* pSrc, size_t count)
+        {
+            using vector_t = TVector;
+
+            size_t i = 0;
+            if constexpr (vector_t::WIDTH > 1)
+            {
+                constexpr size_t width = vector_t::WIDTH;
+                for (; i + width <= count; i += width)
+                    vector_t::Store(pDest + i, vector_t::Load(pSrc + i));
+            }
+
+            for (; i < count; ++i)
+                pDest[i] = static_cast<TDest>(pSrc[i]);
+        }
+
+        /** Gets the entry points of the reduction kernels for one element type. */
+        template<typename T>
+        constexpr ReductionKernelFunctions<T> MakeReductionKernelFunctions()
+        {
+            return {
+                &Reduce<ReductionOperation::Min, T>,
+                &Reduce<ReductionOperation::Max, T>,
+                &Reduce<ReductionOperation::AbsMax, T>,
+                &Sum<T>,
+                &SumOfSquares<T>,
+                &Statistics<T>
+            };
+        }
+
+        /** Gets the entry points of the kernels for one element type. */
+        template<typename T>
+        constexpr ArithmeticKernelFunctions<T> MakeArithmeticKernelFunctions()
+        {
+            return {
+                &ApplyArray<KernelOperation::Add, T>,
+                &ApplyArray<KernelOperation::Subtract, T>,
+                &ApplyArray<KernelOperation::Multiply, T>,
+                &ApplyArray<KernelOperation::Divide, T>,
+                &ApplyScalar<KernelOperation::Add, T>,
+                &ApplyScalar<KernelOperation::Subtract, T>,
+                &ApplyScalar<KernelOperation::Multiply, T>,
+                &ApplyScalar<KernelOperation::Divide, T>
+            };
+        }
+
+        /** Entry points of the kernels compiled in the current translation unit. */
+        constexpr ArithmeticKernelTable ARITHMETIC_KERNEL_TABLE = {
+            MakeArithmeticKernelFunctions<float>(),
+            MakeArithmeticKernelFunctions<double>(),
+            MakeArithmeticKernelFunctions<int32_t>(),
+            MakeArithmeticKernelFunctions<int64_t>(),
+            &ComplexMultiplyArray<>,
+            &ComplexApplyScalar<KernelOperation::Add>,
+            &ComplexApplyScalar<KernelOperation::Subtract>,
+            &ComplexApplyScalar<KernelOperation::Multiply>,
+            MakeReductionKernelFunctions<float>(),
+            MakeReductionKernelFunctions<double>(),
+            &Convert<double, float>,
+            &Convert<float, double>
+        };
+    }
+}
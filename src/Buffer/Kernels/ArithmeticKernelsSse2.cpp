@@ -0,0 +1,41 @@
+#include "ArithmeticKernelTable.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#define HEPH_KERNELS_SSE2
+#include "ArithmeticKernelsImpl.h"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+namespace Heph
+{
+    const ArithmeticKernelTable* ArithmeticKernelTableSse2() noexcept
+    {
+        return &ARITHMETIC_KERNEL_TABLE;
+    }
+}
+
+#else
+
+namespace Heph
+{
+    const ArithmeticKernelTable* ArithmeticKernelTableSse2() noexcept
+    {
+        return nullptr;
+    }
+}
+
+#endif
@@ -0,0 +1,182 @@
+#include "Heph/Buffers/Kernels/KernelDispatch.h"
+#include "ArithmeticKernelTable.h"
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define HEPH_KERNELS_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Heph
+{
+    static std::atomic<InstructionSet> activeInstructionSet = InstructionSet::Generic;
+    static std::atomic<const ArithmeticKernelTable*> activeArithmeticKernels = nullptr;
+
+#if defined(HEPH_KERNELS_X86)
+
+    /** Runs the ``cpuid`` instruction, ``registers`` is filled with eax, ebx, ecx, and edx. */
+    static void CpuId(uint32_t leaf, uint32_t subleaf, uint32_t(&registers)[4])
+    {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (size_t i = 0; i < 4; ++i) registers[i] = static_cast<uint32_t>(info[i]);
+#else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+    }
+
+    /** Reads the register states the OS saves on context switches (XCR0). */
+    static uint64_t ReadXcr0()
+    {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
+
+    static InstructionSet DetectInstructionSet()
+    {
+        uint32_t registers[4];
+
+        CpuId(0, 0, registers);
+        const uint32_t maxLeaf = registers[0];
+        if (maxLeaf < 1) return InstructionSet::Generic;
+
+        CpuId(1, 0, registers);
+        const bool sse2 = (registers[3] & (1u << 26)) != 0;
+        const bool osxsave = (registers[2] & (1u << 27)) != 0;
+        const bool avx = (registers[2] & (1u << 28)) != 0;
+        if (!sse2) return InstructionSet::Generic;
+        if (!osxsave || !avx || maxLeaf < 7) return InstructionSet::SSE2;
+
+        // the OS must save the xmm and ymm registers, and also the opmask and zmm registers for AVX-512
+        const uint64_t xcr0 = ReadXcr0();
+        CpuId(7, 0, registers);
+        const bool avx2 = (registers[1] & (1u << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+        const bool avx512 = (registers[1] & (1u << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+
+        if (avx2 && avx512) return InstructionSet::AVX512;
+        if (avx2) return InstructionSet::AVX2;
+        return InstructionSet::SSE2;
+    }
+
+#else
+
+    static InstructionSet DetectInstructionSet()
+    {
+        return InstructionSet::Generic;
+    }
+
+#endif
+
+    /** Gets the kernels compiled for the instruction set, or nullptr if the library has none for it. */
+    static const ArithmeticKernelTable* GetArithmeticKernelTable(InstructionSet instructionSet) noexcept
+    {
+        switch (instructionSet)
+        {
+        case InstructionSet::AVX512: return ArithmeticKernelTableAvx512();
+        case InstructionSet::AVX2: return ArithmeticKernelTableAvx2();
+        case InstructionSet::SSE2: return ArithmeticKernelTableSse2();
+        default: return ArithmeticKernelTableGeneric();
+        }
+    }
+
+    /** Parses the ``HEPH_KERNEL_ISA`` environment variable, returns ``defaultValue`` if it is not set or invalid. */
+    static InstructionSet ReadEnvironmentVariable(InstructionSet defaultValue) noexcept
+    {
+        const char* value = std::getenv(KernelDispatch::ENVIRONMENT_VARIABLE);
+        if (value == nullptr) return defaultValue;
+
+        for (InstructionSet instructionSet : { InstructionSet::Generic, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512 })
+        {
+            if (std::strcmp(value, KernelDispatch::InstructionSetName(instructionSet)) == 0)
+                return instructionSet;
+        }
+        return defaultValue;
+    }
+
+    /** Switches the kernels to the instruction set, or to the widest narrower one the library has kernels for. */
+    static InstructionSet Activate(InstructionSet instructionSet) noexcept
+    {
+        instructionSet = std::min(instructionSet, KernelDispatch::SupportedInstructionSet());
+
+        const ArithmeticKernelTable* pTable = GetArithmeticKernelTable(instructionSet);
+        while (pTable == nullptr)
+        {
+            instructionSet = static_cast<InstructionSet>(instructionSet - 1);
+            pTable = GetArithmeticKernelTable(instructionSet);
+        }
+
+        activeInstructionSet.store(instructionSet, std::memory_order_relaxed);
+        activeArithmeticKernels.store(pTable, std::memory_order_release);
+        return instructionSet;
+    }
+
+    /** Selects the instruction set on first use, honoring the ``HEPH_KERNEL_ISA`` environment variable. */
+    static void InitializeDispatch() noexcept
+    {
+        static const bool initialized = []()
+            {
+                if (activeArithmeticKernels.load(std::memory_order_acquire) == nullptr)
+                    Activate(ReadEnvironmentVariable(KernelDispatch::SupportedInstructionSet()));
+                return true;
+            }();
+        (void)initialized;
+    }
+
+    const ArithmeticKernelTable& ActiveArithmeticKernelTable() noexcept
+    {
+        const ArithmeticKernelTable* pTable = activeArithmeticKernels.load(std::memory_order_acquire);
+        if (pTable != nullptr) return *pTable;
+
+        InitializeDispatch();
+        return *activeArithmeticKernels.load(std::memory_order_acquire);
+    }
+
+    InstructionSet KernelDispatch::SupportedInstructionSet() noexcept
+    {
+        static const InstructionSet supported = []()
+            {
+                InstructionSet instructionSet = DetectInstructionSet();
+                while (GetArithmeticKernelTable(instructionSet) == nullptr)
+                    instructionSet = static_cast<InstructionSet>(instructionSet - 1);
+                return instructionSet;
+            }();
+        return supported;
+    }
+
+    InstructionSet KernelDispatch::ActiveInstructionSet() noexcept
+    {
+        InitializeDispatch();
+        return activeInstructionSet.load(std::memory_order_relaxed);
+    }
+
+    InstructionSet KernelDispatch::SetInstructionSet(InstructionSet instructionSet) noexcept
+    {
+        InitializeDispatch();
+        return Activate(instructionSet);
+    }
+
+    const char* KernelDispatch::InstructionSetName(InstructionSet instructionSet) noexcept
+    {
+        switch (instructionSet)
+        {
+        case InstructionSet::SSE2: return "sse2";
+        case InstructionSet::AVX2: return "avx2";
+        case InstructionSet::AVX512: return "avx512";
+        default: return "generic";
+        }
+    }
+}
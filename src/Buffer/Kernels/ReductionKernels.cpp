@@ -0,0 +1,62 @@
+#include "Heph/Buffers/Kernels/ReductionKernels.h"
+#include "ArithmeticKernelTable.h"
+#include <type_traits>
+
+namespace Heph
+{
+    /** Gets the reduction kernels of the active instruction set for the element type. */
+    template<typename T>
+    static const ReductionKernelFunctions<T>& KernelFunctions()
+    {
+        const ArithmeticKernelTable& table = ActiveArithmeticKernelTable();
+        if constexpr (std::is_same_v<T, float>) return table.f32Reduction;
+        else return table.f64Reduction;
+    }
+
+    template<ReductionKernelElement T>
+    T ReductionKernels::Min(const T* pData, size_t count)
+    {
+        return KernelFunctions<T>().min(pData, count);
+    }
+
+    template<ReductionKernelElement T>
+    T ReductionKernels::Max(const T* pData, size_t count)
+    {
+        return KernelFunctions<T>().max(pData, count);
+    }
+
+    template<ReductionKernelElement T>
+    T ReductionKernels::AbsMax(const T* pData, size_t count)
+    {
+        return KernelFunctions<T>().absMax(pData, count);
+    }
+
+    template<ReductionKernelElement T>
+    double ReductionKernels::Sum(const T* pData, size_t count)
+    {
+        return KernelFunctions<T>().sum(pData, count);
+    }
+
+    template<ReductionKernelElement T>
+    double ReductionKernels::SumOfSquares(const T* pData, size_t count)
+    {
+        return KernelFunctions<T>().sumOfSquares(pData, count);
+    }
+
+    template<ReductionKernelElement T>
+    BufferStatistics<T> ReductionKernels::Statistics(const T* pData, size_t count)
+    {
+        return KernelFunctions<T>().statistics(pData, count);
+    }
+
+#define HEPH_REDUCTION_KERNELS_INSTANTIATE(T)                                       \
+    template T ReductionKernels::Min<T>(const T*, size_t);                          \
+    template T ReductionKernels::Max<T>(const T*, size_t);                          \
+    template T ReductionKernels::AbsMax<T>(const T*, size_t);                       \
+    template double ReductionKernels::Sum<T>(const T*, size_t);                     \
+    template double ReductionKernels::SumOfSquares<T>(const T*, size_t);            \
+    template BufferStatistics<T> ReductionKernels::Statistics<T>(const T*, size_t)
+
+    HEPH_REDUCTION_KERNELS_INSTANTIATE(float);
+    HEPH_REDUCTION_KERNELS_INSTANTIATE(double);
+}
@@ -0,0 +1,37 @@
+#include "Heph/Parallel.h"
+#include "Heph/ThreadPool.h"
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+namespace Heph
+{
+    static std::atomic<size_t> parallelThreadCount = 0;
+
+    size_t Parallel::ThreadCount() noexcept
+    {
+        const size_t threadCount = parallelThreadCount.load(std::memory_order_relaxed);
+        if (threadCount > 0) return threadCount;
+
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    void Parallel::SetThreadCount(size_t threadCount) noexcept
+    {
+        parallelThreadCount.store(threadCount, std::memory_order_relaxed);
+    }
+
+    void Parallel::For(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& func)
+    {
+        if (begin >= end) return;
+
+        const size_t threadCount = Parallel::ThreadCount();
+        if (threadCount <= 1 || (end - begin) <= std::max(grainSize, 1uz))
+        {
+            func(begin, end);
+            return;
+        }
+
+        ThreadPool::Default().For(begin, end, grainSize, func, threadCount);
+    }
+}
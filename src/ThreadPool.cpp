@@ -0,0 +1,219 @@
+#include "Heph/ThreadPool.h"
+#include "Heph/Parallel.h"
+#include <algorithm>
+#include <exception>
+
+namespace Heph
+{
+    /** Pool whose worker is running on this thread, or nullptr. */
+    static thread_local const ThreadPool* pCurrentPool = nullptr;
+    /** Queue index of the worker running on this thread. */
+    static thread_local size_t currentQueueIndex = 0;
+
+    /** Number of chunks ThreadPool::For creates per thread, more chunks balance the load better but cost more synchronization. */
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    static void RunTask(ThreadPool::Task& task) noexcept
+    {
+        try
+        {
+            task();
+        }
+        catch (...) {}
+        task = nullptr;
+    }
+
+    ThreadPool::ThreadPool(size_t threadCount)
+        : pendingTaskCount(0), nextQueueIndex(0), isStopping(false)
+    {
+        this->queues.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            this->queues.push_back(std::make_unique<WorkerQueue>());
+
+        this->threads.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            this->threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->wakeMutex);
+            this->isStopping = true;
+        }
+        this->wakeCondition.notify_all();
+        this->threads.clear();
+    }
+
+    size_t ThreadPool::ThreadCount() const noexcept
+    {
+        return this->queues.size();
+    }
+
+    void ThreadPool::Submit(Task task)
+    {
+        if (this->queues.empty())
+        {
+            RunTask(task);
+            return;
+        }
+
+        const size_t queueIndex = (pCurrentPool == this)
+            ? currentQueueIndex
+            : (this->nextQueueIndex.fetch_add(1, std::memory_order_relaxed) % this->queues.size());
+
+        this->Push(queueIndex, std::move(task));
+    }
+
+    bool ThreadPool::RunPendingTask()
+    {
+        if (this->queues.empty()) return false;
+
+        Task task;
+        const bool hasTask = (pCurrentPool == this)
+            ? (this->TryPop(currentQueueIndex, task) || this->TrySteal(currentQueueIndex + 1, task))
+            : this->TrySteal(this->nextQueueIndex.load(std::memory_order_relaxed), task);
+
+        if (hasTask) RunTask(task);
+        return hasTask;
+    }
+
+    void ThreadPool::For(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& func, size_t maxThreadCount)
+    {
+        if (begin >= end) return;
+
+        const size_t count = end - begin;
+        grainSize = std::max(grainSize, 1uz);
+
+        const size_t maxChunkCount = (count + grainSize - 1) / grainSize;
+        if (maxThreadCount == 0) maxThreadCount = this->queues.size() + 1;
+
+        const size_t threadCount = std::min({ maxThreadCount, this->queues.size() + 1, maxChunkCount });
+        if (threadCount <= 1)
+        {
+            func(begin, end);
+            return;
+        }
+
+        struct ForState
+        {
+            std::atomic<size_t> nextChunkIndex = 0;
+            std::atomic<size_t> completedChunkCount = 0;
+            std::mutex mutex;
+            std::condition_variable completedCondition;
+            std::exception_ptr exception;
+        };
+
+        // runners may start after all chunks are completed, they keep the state alive but never touch func then
+        const std::shared_ptr<ForState> pState = std::make_shared<ForState>();
+        const size_t chunkCount = std::min(maxChunkCount, threadCount * CHUNKS_PER_THREAD);
+        const auto runChunks = [pState, &func, begin, count, chunkCount]()
+            {
+                for (size_t chunkIndex; (chunkIndex = pState->nextChunkIndex.fetch_add(1)) < chunkCount;)
+                {
+                    try
+                    {
+                        func(begin + (count * chunkIndex) / chunkCount, begin + (count * (chunkIndex + 1)) / chunkCount);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(pState->mutex);
+                        if (!pState->exception) pState->exception = std::current_exception();
+                    }
+
+                    if (pState->completedChunkCount.fetch_add(1) + 1 == chunkCount)
+                    {
+                        std::lock_guard<std::mutex> lock(pState->mutex);
+                        pState->completedCondition.notify_all();
+                    }
+                }
+            };
+
+        for (size_t i = 1; i < threadCount; ++i)
+            this->Submit(runChunks);
+
+        runChunks();
+
+        while (pState->completedChunkCount.load() < chunkCount)
+        {
+            if (this->RunPendingTask()) continue;
+
+            std::unique_lock<std::mutex> lock(pState->mutex);
+            pState->completedCondition.wait(lock, [&pState, chunkCount]() { return pState->completedChunkCount.load() >= chunkCount; });
+        }
+
+        if (pState->exception) std::rethrow_exception(pState->exception);
+    }
+
+    ThreadPool& ThreadPool::Default()
+    {
+        static ThreadPool defaultPool(std::max<size_t>(std::thread::hardware_concurrency(), Parallel::ThreadCount()) - 1);
+        return defaultPool;
+    }
+
+    void ThreadPool::WorkerLoop(size_t queueIndex)
+    {
+        pCurrentPool = this;
+        currentQueueIndex = queueIndex;
+
+        Task task;
+        while (true)
+        {
+            if (this->TryPop(queueIndex, task) || this->TrySteal(queueIndex + 1, task))
+            {
+                RunTask(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(this->wakeMutex);
+            this->wakeCondition.wait(lock, [this]() { return this->isStopping || this->pendingTaskCount.load() > 0; });
+            if (this->isStopping && this->pendingTaskCount.load() == 0) return;
+        }
+    }
+
+    void ThreadPool::Push(size_t queueIndex, Task&& task)
+    {
+        {
+            // count the task before publishing it, so a thief that takes it right away cannot decrement the counter below zero
+            WorkerQueue& queue = *this->queues[queueIndex];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            this->pendingTaskCount.fetch_add(1);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        // a worker that checked the counter before the increment is either waiting or about to wait after releasing the mutex
+        {
+            std::lock_guard<std::mutex> lock(this->wakeMutex);
+        }
+        this->wakeCondition.notify_one();
+    }
+
+    bool ThreadPool::TryPop(size_t queueIndex, Task& task)
+    {
+        WorkerQueue& queue = *this->queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) return false;
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        this->pendingTaskCount.fetch_sub(1);
+        return true;
+    }
+
+    bool ThreadPool::TrySteal(size_t firstQueueIndex, Task& task)
+    {
+        const size_t queueCount = this->queues.size();
+        for (size_t i = 0; i < queueCount; ++i)
+        {
+            WorkerQueue& queue = *this->queues[(firstQueueIndex + i) % queueCount];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) continue;
+
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            this->pendingTaskCount.fetch_sub(1);
+            return true;
+        }
+        return false;
+    }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "Heph/Buffers/ArithmeticBuffer.h"
+#include <memory_resource>
 
 using namespace Heph;
 using test_data_t = double;
@@ -36,6 +37,213 @@ TEST(HephTest, ArithmeticBuffer_Rms)
     }
 }
 
+TEST(HephTest, ArithmeticBuffer_ParallelReduction)
+{
+    Parallel::SetThreadCount(4);
+
+    constexpr size_t count = 1000001;
+    ArithmeticTestBuffer<1> b(count);
+    for (size_t i = 0; i < count; ++i)
+        b[i] = static_cast<test_data_t>(i % 1000) * 0.001;
+    b[777777] = -3;
+    b[999999] = 2;
+
+    EXPECT_EQ(b.Min(), -3);
+    EXPECT_EQ(b.Max(), 2);
+    EXPECT_EQ(b.AbsMax(), 3);
+
+    double sumSquared = 0;
+    for (size_t i = 0; i < count; ++i) sumSquared += b[i] * b[i];
+    EXPECT_NEAR(b.Rms(), std::sqrt(sumSquared / count), 1e-12);
+
+    Parallel::SetThreadCount(0);
+}
+
+TEST(HephTest, ArithmeticBuffer_Statistics)
+{
+    {
+        ArithmeticTestBuffer<2> b = { {1, -65}, {27, 31}, {18, 3} };
+        const BufferStatistics<test_data_t> statistics = b.Statistics();
+        EXPECT_EQ(statistics.count, 6);
+        EXPECT_EQ(statistics.min, -65);
+        EXPECT_EQ(statistics.max, 31);
+        EXPECT_EQ(statistics.absMax, 65);
+        EXPECT_DOUBLE_EQ(statistics.sum, 15);
+        EXPECT_DOUBLE_EQ(statistics.mean, 2.5);
+        EXPECT_DOUBLE_EQ(statistics.Variance(), 1035.25);
+        EXPECT_NEAR(statistics.Rms(), b.Rms(), 1e-12);
+
+        // strided view, uses the scalar path
+        const BufferStatistics<test_data_t> columnStatistics = ArithmeticTestBuffer<2>::Statistics(b.Slice(1, 1, 1));
+        EXPECT_EQ(columnStatistics.count, 3);
+        EXPECT_EQ(columnStatistics.min, -65);
+        EXPECT_EQ(columnStatistics.max, 31);
+        EXPECT_DOUBLE_EQ(columnStatistics.mean, -31.0 / 3.0);
+    }
+
+    {
+        ArithmeticTestBuffer<1> b;
+        const BufferStatistics<test_data_t> statistics = b.Statistics();
+        EXPECT_EQ(statistics.count, 0);
+        EXPECT_EQ(statistics.Variance(), 0);
+        EXPECT_EQ(statistics.Rms(), 0);
+    }
+
+    {
+        Parallel::SetThreadCount(4);
+
+        // large offset so that the naive variance formula would cancel out
+        constexpr size_t count = 1000000;
+        ArithmeticTestBuffer<1> b(count);
+        for (size_t i = 0; i < count; ++i)
+            b[i] = 1e6 + static_cast<test_data_t>(i % 10);
+
+        const BufferStatistics<test_data_t> statistics = b.Statistics();
+        EXPECT_EQ(statistics.count, count);
+        EXPECT_EQ(statistics.min, b.Min());
+        EXPECT_EQ(statistics.max, b.Max());
+        EXPECT_EQ(statistics.absMax, b.AbsMax());
+        EXPECT_NEAR(statistics.Rms(), b.Rms(), 1e-9);
+        EXPECT_NEAR(statistics.mean, 1e6 + 4.5, 1e-6);
+        EXPECT_NEAR(statistics.Variance(), 8.25, 1e-6);
+
+        Parallel::SetThreadCount(0);
+    }
+
+    {
+        BufferStatistics<test_data_t> lhs, rhs, all;
+        for (int i = 0; i < 10; ++i)
+        {
+            (i < 3 ? lhs : rhs).Add(i * 1.5 - 4);
+            all.Add(i * 1.5 - 4);
+        }
+
+        lhs.Merge(rhs);
+        EXPECT_EQ(lhs.count, all.count);
+        EXPECT_EQ(lhs.min, all.min);
+        EXPECT_EQ(lhs.max, all.max);
+        EXPECT_EQ(lhs.absMax, all.absMax);
+        EXPECT_NEAR(lhs.mean, all.mean, 1e-12);
+        EXPECT_NEAR(lhs.Variance(), all.Variance(), 1e-12);
+        EXPECT_NEAR(lhs.Rms(), all.Rms(), 1e-12);
+    }
+}
+
+TEST(HephTest, ArithmeticBuffer_AxisReduction)
+{
+    {
+        ArithmeticTestBuffer<2> b = { {1, -65}, {27, 31}, {18, 3} };
+
+        const ArithmeticTestBuffer<1> sum0 = b.Sum(0);
+        ASSERT_EQ(sum0.Size(), 2);
+        EXPECT_EQ(sum0[0], 46);
+        EXPECT_EQ(sum0[1], -31);
+
+        const ArithmeticTestBuffer<1> sum1 = b.Sum(1);
+        ASSERT_EQ(sum1.Size(), 3);
+        EXPECT_EQ(sum1[0], -64);
+        EXPECT_EQ(sum1[1], 58);
+        EXPECT_EQ(sum1[2], 21);
+
+        const ArithmeticTestBuffer<1> mean0 = b.Mean(0);
+        EXPECT_DOUBLE_EQ(mean0[0], 46.0 / 3.0);
+        EXPECT_DOUBLE_EQ(mean0[1], -31.0 / 3.0);
+
+        const ArithmeticTestBuffer<1> min0 = b.Min(0);
+        EXPECT_EQ(min0[0], 1);
+        EXPECT_EQ(min0[1], -65);
+
+        const ArithmeticTestBuffer<1> max1 = b.Max(1);
+        EXPECT_EQ(max1[0], 1);
+        EXPECT_EQ(max1[1], 31);
+        EXPECT_EQ(max1[2], 18);
+
+        const ArithmeticBuffer<double, 1> rms0 = b.Rms(0);
+        EXPECT_DOUBLE_EQ(rms0[0], std::sqrt((1.0 + 27 * 27 + 18 * 18) / 3.0));
+        EXPECT_DOUBLE_EQ(rms0[1], std::sqrt((65.0 * 65 + 31 * 31 + 3 * 3) / 3.0));
+
+        // strided view, copied to contiguous memory first
+        const ArithmeticTestBuffer<1> viewSum = ArithmeticTestBuffer<2>::Sum(b.Slice(0, 0, 2, 2), 0);
+        EXPECT_EQ(viewSum[0], 19);
+        EXPECT_EQ(viewSum[1], -62);
+
+        EXPECT_THROW(b.Sum(2), InvalidArgumentException);
+    }
+
+    {
+        ArithmeticTestBuffer<3> b(3, 4, 5);
+        for (size_t i = 0; i < 3; ++i)
+            for (size_t j = 0; j < 4; ++j)
+                for (size_t k = 0; k < 5; ++k)
+                    b[i, j, k] = static_cast<test_data_t>((i * 7 + j * 3 + k * 11) % 13) - 6;
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const ArithmeticTestBuffer<2> sum = b.Sum(axis);
+            const ArithmeticTestBuffer<2> max = b.Max(axis);
+
+            for (size_t i = 0; i < sum.Size(0); ++i)
+            {
+                for (size_t j = 0; j < sum.Size(1); ++j)
+                {
+                    test_data_t expectedSum = 0;
+                    test_data_t expectedMax = std::numeric_limits<test_data_t>::lowest();
+                    for (size_t k = 0; k < b.Size(axis); ++k)
+                    {
+                        const test_data_t x = (axis == 0) ? b[k, i, j] : ((axis == 1) ? b[i, k, j] : b[i, j, k]);
+                        expectedSum += x;
+                        expectedMax = std::max(expectedMax, x);
+                    }
+                    EXPECT_EQ((sum[i, j]), expectedSum);
+                    EXPECT_EQ((max[i, j]), expectedMax);
+                }
+            }
+        }
+    }
+    {
+        class CountingResource : public std::pmr::memory_resource
+        {
+        public:
+            size_t allocationCount = 0;
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override
+            {
+                this->allocationCount++;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* p, size_t bytes, size_t alignment) override
+            {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        // the results and the contiguous copies use the allocator of the buffer
+        using PmrTestBuffer = ArithmeticBuffer<test_data_t, 2, BufferIterator, std::pmr::polymorphic_allocator>;
+        CountingResource resource;
+        const PmrTestBuffer b({ {1, -65}, {27, 31}, {18, 3} }, &resource);
+        EXPECT_EQ(resource.allocationCount, 1);
+
+        const ArithmeticBuffer<test_data_t, 1, BufferIterator, std::pmr::polymorphic_allocator> sum0 = b.Sum(0);
+        EXPECT_EQ(resource.allocationCount, 2);
+        EXPECT_EQ(sum0, (ArithmeticBuffer<test_data_t, 1, BufferIterator, std::pmr::polymorphic_allocator>({ 46, -31 })));
+
+        const ArithmeticBuffer<double, 1, BufferIterator, std::pmr::polymorphic_allocator> rms1 = b.Rms(Execution::seq, 1);
+        EXPECT_EQ(resource.allocationCount, 3);
+        EXPECT_DOUBLE_EQ(rms1[2], std::sqrt((18.0 * 18 + 3 * 3) / 2.0));
+
+        const auto viewMean = PmrTestBuffer::Mean(b.Slice(0, 0, 2, 2), 0, &resource);
+        EXPECT_EQ(resource.allocationCount, 5);
+        EXPECT_EQ(viewMean[0], 9.5);
+    }
+}
+
 TEST(HephTest, ArithmeticBuffer_Invert)
 {
     {
@@ -250,4 +458,347 @@ TEST(HephTest, ArithmeticBuffer_Operators_Buffer)
             for (size_t j = 0; j < b1.Size(1); ++j)
                 EXPECT_NEAR((b1[i, j]), expected[i][j], 0.005);
     }
-}
\ No newline at end of file
+}
+TEST(HephTest, ArithmeticBuffer_MakeContiguous)
+{
+    ArithmeticTestBuffer<3> b(5, 33, 40);
+    for (size_t i = 0; i < b.Size(0); ++i)
+        for (size_t j = 0; j < b.Size(1); ++j)
+            for (size_t k = 0; k < b.Size(2); ++k)
+                b[i, j, k] = i * 10000 + j * 100 + k;
+
+    const ArithmeticTestBuffer<3> expected = [&]()
+        {
+            ArithmeticTestBuffer<3> result = b;
+            result.Transpose(TransposeMode::Normal, 2, 0, 1);
+            return result;
+        }();
+
+    b.Transpose(TransposeMode::InPlace, 2, 0, 1);
+    EXPECT_FALSE(b.IsContiguous());
+
+    b.MakeContiguous();
+    EXPECT_TRUE(b.IsContiguous());
+    EXPECT_EQ(b, expected);
+    EXPECT_EQ((b[39, 4, 32]), 43239);
+}
+
+TEST(HephTest, ArithmeticBuffer_Expression)
+{
+    {
+        const ArithmeticTestBuffer<1> a = { 1, 2, 3, 4 };
+        const ArithmeticTestBuffer<1> b = { 5, 6, 7, 8 };
+        const ArithmeticTestBuffer<1> c = { 1, 1, 2, 2 };
+        const ArithmeticTestBuffer<1> d(3);
+        const ArithmeticTestBuffer<1> e = { 1, 0, 2, 0, 3, 0, 4, 0 };
+
+        ArithmeticTestBuffer<1> result = a * 2 + b - c;
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 6, 9, 11, 14 }));
+
+        result = 10 - a / (b - 4);
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 9, 9, 9, 9 }));
+
+        // strided view operand
+        result = (result - a) * 0.5 + e.Slice(0, 0, 4, 2);
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 5, 5.5, 6, 6.5 }));
+
+        result = result * 2 + result;
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 15, 16.5, 18, 19.5 }));
+
+        result -= a * c;
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 14, 14.5, 12, 11.5 }));
+
+        EXPECT_THROW(a + d, InvalidOperationException);
+        EXPECT_THROW(result += d * 2, InvalidOperationException);
+
+        result = d + 1;
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 1, 1, 1 }));
+    }
+
+    {
+        const ArithmeticTestBuffer<2> a = { {1, 2, 3}, {4, 5, 6} };
+        ArithmeticTestBuffer<2> b = { {1, 4}, {2, 5}, {3, 6} };
+        b.Transpose(TransposeMode::InPlace, 1, 0);
+
+        const ArithmeticTestBuffer<2> result = (a + b) * 10 - 1;
+        EXPECT_EQ(result, (ArithmeticTestBuffer<2>({ {19, 39, 59}, {79, 99, 119} })));
+
+        b = b / a + a;
+        EXPECT_FALSE(b.IsContiguous());
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {2, 3, 4}, {5, 6, 7} })));
+    }
+}
+
+TEST(HephTest, ArithmeticBuffer_Broadcasting)
+{
+    {
+        // per-channel gains
+        ArithmeticTestBuffer<2> b = { {1, 2, 3}, {4, 5, 6} };
+        const ArithmeticTestBuffer<1> gains = { 2, 3, 4 };
+
+        b *= gains;
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {2, 6, 12}, {8, 15, 24} })));
+
+        b -= ArithmeticTestBuffer<2>({ {1, 2, 3} });
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {1, 4, 9}, {7, 13, 21} })));
+
+        EXPECT_THROW(b += ArithmeticTestBuffer<1>({ 1, 2 }), InvalidOperationException);
+        EXPECT_THROW(b += ArithmeticTestBuffer<2>({ {1, 2, 3}, {4, 5, 6}, {7, 8, 9} }), InvalidOperationException);
+    }
+
+    {
+        // per-row operands, constant within each row
+        ArithmeticTestBuffer<2> b = { {1, 2, 3}, {4, 5, 6} };
+        b += ArithmeticTestBuffer<2>({ {10}, {20} });
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {11, 12, 13}, {24, 25, 26} })));
+
+        b /= ArithmeticTestBuffer<2>({ {1}, {2} }).View();
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {11, 12, 13}, {12, 12.5, 13} })));
+    }
+
+    {
+        // strided and 3-dimensional operands
+        ArithmeticTestBuffer<3> b(2, 3, 4);
+        const ArithmeticTestBuffer<2> rows = { {1, 0, 2, 0, 3, 0, 4, 0}, {5, 0, 6, 0, 7, 0, 8, 0}, {9, 0, 10, 0, 11, 0, 12, 0} };
+
+        b += rows.Slice(1, 0, 4, 2);
+        b *= ArithmeticTestBuffer<3>({ { {1} }, { {-1} } });
+        for (size_t i = 0; i < 2; ++i)
+            for (size_t j = 0; j < 3; ++j)
+                for (size_t k = 0; k < 4; ++k)
+                    EXPECT_EQ((b[i, j, k]), (i == 0 ? 1.0 : -1.0) * (j * 4 + k + 1));
+    }
+
+    {
+        // expressions
+        const ArithmeticTestBuffer<2> a = { {1, 2}, {3, 4}, {5, 6} };
+        const ArithmeticTestBuffer<2> column = { {1}, {2}, {3} };
+        const ArithmeticTestBuffer<2> row = { {10, 20} };
+
+        ArithmeticTestBuffer<2> result = a * row + column;
+        EXPECT_EQ(result, (ArithmeticTestBuffer<2>({ {11, 41}, {32, 82}, {53, 123} })));
+
+        result = column + row;
+        EXPECT_EQ(result, (ArithmeticTestBuffer<2>({ {11, 21}, {12, 22}, {13, 23} })));
+
+        result += row * 2;
+        EXPECT_EQ(result, (ArithmeticTestBuffer<2>({ {31, 61}, {32, 62}, {33, 63} })));
+
+        EXPECT_THROW(a + ArithmeticTestBuffer<2>({ {1, 2, 3} }), InvalidOperationException);
+        EXPECT_THROW(result -= a + ArithmeticTestBuffer<2>(4, 2), InvalidOperationException);
+    }
+    {
+        // operands that are broadcast from the memory of the destination are read before they are overwritten
+        const ArithmeticTestBuffer<2> initial = { {1, 2}, {3, 4} };
+
+        ArithmeticTestBuffer<2> b = initial;
+        b += b.Slice(0, 0, 1);
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {2, 4}, {4, 6} })));
+
+        b = initial;
+        b.Add(Execution::seq, b.Slice(0, 0, 1));
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {2, 4}, {4, 6} })));
+
+        b = initial;
+        b -= b.Slice(1, 1, 1);
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {-1, 0}, {-1, 0} })));
+
+        b = initial;
+        b *= b.Slice(0, 1, 1).Slice(1, 0, 1);
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {3, 6}, {9, 12} })));
+
+        b = initial;
+        b = b + b.Slice(0, 0, 1);
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {2, 4}, {4, 6} })));
+
+        b = initial;
+        b = b.Slice(0, 1, 1) + b * 2;
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {5, 8}, {9, 12} })));
+
+        b = initial;
+        b += b.Slice(0, 1, 1) - b;
+        EXPECT_EQ(b, (ArithmeticTestBuffer<2>({ {3, 4}, {3, 4} })));
+    }
+}
+
+TEST(HephTest, ArithmeticBuffer_RvalueOperators)
+{
+    {
+        const ArithmeticTestBuffer<1> a = { 1, 2, 3, 4 };
+        ArithmeticTestBuffer<1> b = { 5, 6, 7, 8 };
+        const test_data_t* pData = &b[0];
+
+        ArithmeticTestBuffer<1> result = std::move(b) + a;
+        EXPECT_EQ(&result[0], pData);
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 6, 8, 10, 12 }));
+
+        result = a - std::move(result);
+        EXPECT_EQ(&result[0], pData);
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ -5, -6, -7, -8 }));
+
+        result = 10 * std::move(result) / 5;
+        EXPECT_EQ(&result[0], pData);
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ -10, -12, -14, -16 }));
+
+        result = -std::move(result);
+        EXPECT_EQ(&result[0], pData);
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 10, 12, 14, 16 }));
+
+        result = ArithmeticTestBuffer<1>({ 1, 2, 3, 4 }) * ArithmeticTestBuffer<1>({ 2, 2, 2, 2 });
+        EXPECT_EQ(result, ArithmeticTestBuffer<1>({ 2, 4, 6, 8 }));
+
+        EXPECT_THROW(std::move(result) + ArithmeticTestBuffer<1>(3), InvalidOperationException);
+    }
+
+    {
+        // the result is larger than the rvalue operand
+        const ArithmeticTestBuffer<2> a = { {1, 1}, {2, 2} };
+        ArithmeticTestBuffer<2> result = ArithmeticTestBuffer<2>({ {1, 2} }) + a;
+        EXPECT_EQ(result, (ArithmeticTestBuffer<2>({ {2, 3}, {3, 4} })));
+
+        result = a / ArithmeticTestBuffer<2>({ {1}, {2} });
+        EXPECT_EQ(result, (ArithmeticTestBuffer<2>({ {1, 1}, {1, 1} })));
+    }
+
+    {
+        // out-of-place kernels
+        const ArithmeticBuffer<int32_t, 1> a = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 };
+        const ArithmeticBuffer<int32_t, 1> b = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
+
+        ArithmeticBuffer<int32_t, 1> result = a - b;
+        for (size_t i = 0; i < result.ElementCount(); ++i) EXPECT_EQ(result[i], a[i] - 2);
+
+        result = 3 * a;
+        for (size_t i = 0; i < result.ElementCount(); ++i) EXPECT_EQ(result[i], a[i] * 3);
+
+        result = 20 - a;
+        for (size_t i = 0; i < result.ElementCount(); ++i) EXPECT_EQ(result[i], 20 - a[i]);
+
+        result = result / b;
+        for (size_t i = 0; i < result.ElementCount(); ++i) EXPECT_EQ(result[i], (20 - a[i]) / 2);
+    }
+}
+
+TEST(HephTest, ArithmeticBuffer_ParallelKernels)
+{
+    // large enough to be split across threads
+    Parallel::SetThreadCount(4);
+
+    {
+        constexpr size_t count = 1uz << 19;
+        ArithmeticTestBuffer<1> a(count);
+        ArithmeticTestBuffer<1> b(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            a[i] = static_cast<test_data_t>(i);
+            b[i] = static_cast<test_data_t>(2 * i);
+        }
+
+        ArithmeticTestBuffer<1> result = a + b;
+        result *= 2;
+        result -= a;
+        result /= 5;
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(result[i], static_cast<test_data_t>(i));
+
+        result += a.View();
+        result = result / 2.0;
+        EXPECT_EQ(result, a);
+    }
+
+    {
+        ArithmeticTestBuffer<2> b(1024, 512);
+        ArithmeticTestBuffer<1> row(512);
+        ArithmeticTestBuffer<2> column(1024, 1);
+        for (size_t i = 0; i < 512; ++i) row[i] = static_cast<test_data_t>(i);
+        for (size_t i = 0; i < 1024; ++i) (column[i, 0]) = static_cast<test_data_t>(i * 1000);
+
+        b += row;
+        b += column.View();
+        for (size_t i = 0; i < 1024; ++i)
+        {
+            for (size_t j = 0; j < 512; ++j)
+                EXPECT_EQ((b[i, j]), static_cast<test_data_t>(i * 1000 + j));
+        }
+
+        // an operand that shares memory with the buffer in another layout is processed in order
+        b += b.Slice(0, 1023, 1);
+        EXPECT_EQ((b[0, 5]), 1023005 + 5);
+        EXPECT_EQ((b[1023, 5]), 2 * 1023005);
+    }
+
+    Parallel::SetThreadCount(0);
+}
+
+TEST(HephTest, ArithmeticBuffer_ExecutionPolicy)
+{
+    Parallel::SetThreadCount(4);
+
+    const auto fill = [](ArithmeticTestBuffer<2>& b)
+        {
+            size_t i = 0;
+            for (test_data_t& element : b) element = static_cast<test_data_t>(i++ % 1000) - 500;
+        };
+
+    ArithmeticTestBuffer<2> seqBuffer(512, 1024);
+    ArithmeticTestBuffer<2> parBuffer(512, 1024);
+    fill(seqBuffer);
+    fill(parBuffer);
+
+    const ArithmeticTestBuffer<1> row = ArithmeticTestBuffer<2>(seqBuffer.Slice(0, 1, 1)).Sum(0);
+
+    const ArithmeticTestBuffer<2> other = seqBuffer * 0.5;
+    seqBuffer.Add(Execution::seq, 3).Multiply(Execution::unseq, other).Subtract(Execution::seq, row).Divide(Execution::seq, 4);
+    parBuffer.Add(Execution::par, 3).Multiply(Execution::par_unseq, other).Subtract(Execution::par, row).Divide(Execution::par, 4);
+    EXPECT_EQ(seqBuffer, parBuffer);
+
+    const ArithmeticTestBuffer<2> seqSum(Execution::seq, seqBuffer + other);
+    EXPECT_EQ(seqSum, ArithmeticTestBuffer<2>(seqBuffer + other));
+    ArithmeticTestBuffer<2> seqProduct(512, 1024);
+    const test_data_t* pProduct = &seqProduct[0, 0];
+    seqProduct.Assign(Execution::seq, 2 * seqBuffer);
+    EXPECT_EQ((&seqProduct[0, 0]), pProduct);
+    EXPECT_EQ(seqProduct, ArithmeticTestBuffer<2>(seqBuffer * 2));
+
+    fill(seqBuffer);
+    fill(parBuffer);
+    EXPECT_EQ(seqBuffer.Min(Execution::seq), parBuffer.Min(Execution::par));
+    EXPECT_EQ(seqBuffer.Max(Execution::seq), parBuffer.Max());
+    EXPECT_EQ(seqBuffer.AbsMax(Execution::unseq), parBuffer.AbsMax(Execution::par));
+    EXPECT_NEAR(seqBuffer.Rms(Execution::seq), parBuffer.Rms(Execution::par), 1e-9);
+    EXPECT_EQ(seqBuffer.Statistics(Execution::seq).count, parBuffer.Statistics(Execution::par).count);
+    EXPECT_EQ(seqBuffer.Sum(Execution::seq, 1), parBuffer.Sum(Execution::par, 1));
+    EXPECT_EQ(seqBuffer.Mean(Execution::seq, 0), parBuffer.Mean(Execution::par, 0));
+    EXPECT_EQ(seqBuffer.Min(Execution::seq, 1), parBuffer.Min(1));
+    EXPECT_EQ(seqBuffer.Max(Execution::seq, 0), parBuffer.Max(Execution::par, 0));
+    EXPECT_EQ(seqBuffer.Rms(Execution::seq, 1), parBuffer.Rms(Execution::par, 1));
+    EXPECT_EQ(ArithmeticTestBuffer<2>::Min(Execution::seq, seqBuffer.View()), ArithmeticTestBuffer<2>::Min(parBuffer.View()));
+
+    seqBuffer.Transpose(Execution::seq, TransposeMode::Normal, 1, 0);
+    parBuffer.Transpose(Execution::par, TransposeMode::Normal, 1, 0);
+    EXPECT_EQ(seqBuffer, parBuffer);
+    EXPECT_EQ(seqBuffer.Size(), ArithmeticTestBuffer<2>::buffer_size_t({ 1024, 512 }));
+
+    seqBuffer.Reverse(Execution::seq, 1);
+    parBuffer.Reverse(Execution::par, 1);
+    EXPECT_EQ(seqBuffer, parBuffer);
+    EXPECT_EQ((seqBuffer[0, 0]), 511 * 1024 % 1000 - 500);
+    EXPECT_EQ((seqBuffer[0, 511]), -500);
+
+    seqBuffer.Transpose(Execution::seq, TransposeMode::InPlace, 1, 0);
+    parBuffer.Transpose(Execution::par, TransposeMode::InPlace, 1, 0);
+    seqBuffer.Resize(Execution::seq, 600, 1000);
+    parBuffer.Resize(Execution::par, 600, 1000);
+    EXPECT_EQ(seqBuffer, parBuffer);
+    EXPECT_TRUE(seqBuffer.IsContiguous());
+    EXPECT_EQ((seqBuffer[599, 999]), 0);
+    EXPECT_EQ((seqBuffer[511, 999]), 999 - 500);
+
+    ArithmeticTestBuffer<1> b = { 1, 2, 3, 4, 5 };
+    b.Reverse(Execution::seq);
+    EXPECT_EQ(b, ArithmeticTestBuffer<1>({ 5, 4, 3, 2, 1 }));
+    b.Resize(Execution::par, 7);
+    EXPECT_EQ(b, ArithmeticTestBuffer<1>({ 5, 4, 3, 2, 1, 0, 0 }));
+
+    Parallel::SetThreadCount(0);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/Kernels/ArithmeticKernels.h"
+#include <vector>
+
+using namespace Heph;
+
+template<typename T>
+static void TestArithmeticKernels()
+{
+    // odd count so that both the vector and the scalar tails run
+    constexpr size_t count = 67;
+
+    std::vector<T> lhs(count), rhs(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        lhs[i] = static_cast<T>(i * 3 + 7);
+        rhs[i] = static_cast<T>(i % 5 + 1);
+    }
+
+    std::vector<T> result = lhs;
+    ArithmeticKernels::Add(result.data(), rhs.data(), count);
+    ArithmeticKernels::Multiply(result.data(), rhs.data(), count);
+    ArithmeticKernels::Subtract(result.data(), rhs.data(), count);
+    ArithmeticKernels::Divide(result.data(), rhs.data(), count);
+    ArithmeticKernels::Add(result.data(), T(2), count);
+    ArithmeticKernels::Multiply(result.data(), T(3), count);
+    ArithmeticKernels::Subtract(result.data(), T(1), count);
+    ArithmeticKernels::Divide(result.data(), T(2), count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        T expected = lhs[i];
+        expected += rhs[i];
+        expected *= rhs[i];
+        expected -= rhs[i];
+        expected /= rhs[i];
+        expected += T(2);
+        expected *= T(3);
+        expected -= T(1);
+        expected /= T(2);
+        EXPECT_EQ(result[i], expected);
+    }
+
+    // out-of-place, the destination can also be an operand
+    std::vector<T> dest(count);
+    ArithmeticKernels::Add(dest.data(), lhs.data(), rhs.data(), count);
+    for (size_t i = 0; i < count; ++i) EXPECT_EQ(dest[i], static_cast<T>(lhs[i] + rhs[i]));
+    ArithmeticKernels::Subtract(dest.data(), lhs.data(), dest.data(), count);
+    for (size_t i = 0; i < count; ++i) EXPECT_EQ(dest[i], static_cast<T>(-rhs[i]));
+    ArithmeticKernels::Multiply(dest.data(), lhs.data(), T(3), count);
+    for (size_t i = 0; i < count; ++i) EXPECT_EQ(dest[i], static_cast<T>(lhs[i] * T(3)));
+    ArithmeticKernels::Divide(dest.data(), lhs.data(), rhs.data(), count);
+    for (size_t i = 0; i < count; ++i) EXPECT_EQ(dest[i], static_cast<T>(lhs[i] / rhs[i]));
+
+    // partially overlapping arrays must give the same results as a plain loop
+    std::vector<T> overlapping = lhs;
+    std::vector<T> expected = lhs;
+    ArithmeticKernels::Add(overlapping.data() + 1, overlapping.data(), count - 1);
+    for (size_t i = 1; i < count; ++i) expected[i] += expected[i - 1];
+    EXPECT_EQ(overlapping, expected);
+}
+
+TEST(HephTest, ArithmeticKernels)
+{
+    TestArithmeticKernels<float>();
+    TestArithmeticKernels<double>();
+    TestArithmeticKernels<int32_t>();
+    TestArithmeticKernels<int64_t>();
+
+    {
+        constexpr size_t count = 13;
+        std::vector<std::complex<double>> lhs(count), rhs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            lhs[i] = std::complex<double>(i + 1.0, -2.0 * i);
+            rhs[i] = std::complex<double>(0.5 * i, i % 3 + 1.0);
+        }
+
+        std::vector<std::complex<double>> result = lhs;
+        ArithmeticKernels::Multiply(result.data(), rhs.data(), count);
+        ArithmeticKernels::Add(result.data(), rhs.data(), count);
+        ArithmeticKernels::Multiply(result.data(), std::complex<double>(2, -1), count);
+        ArithmeticKernels::Subtract(result.data(), std::complex<double>(1, 1), count);
+        ArithmeticKernels::Multiply(result.data(), 0.5, count);
+        ArithmeticKernels::Divide(result.data(), rhs.data(), count);
+        ArithmeticKernels::Divide(result.data(), 4.0, count);
+
+        std::vector<std::complex<double>> dest(count);
+        ArithmeticKernels::Multiply(dest.data(), lhs.data(), rhs.data(), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(dest[i], lhs[i] * rhs[i]);
+        ArithmeticKernels::Subtract(dest.data(), lhs.data(), std::complex<double>(1, 1), count);
+        for (size_t i = 0; i < count; ++i) EXPECT_EQ(dest[i], lhs[i] - std::complex<double>(1, 1));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const std::complex<double> expected = ((lhs[i] * rhs[i] + rhs[i]) * std::complex<double>(2, -1) - std::complex<double>(1, 1)) * 0.5 / rhs[i] / 4.0;
+            EXPECT_NEAR(result[i].real(), expected.real(), 1e-9);
+            EXPECT_NEAR(result[i].imag(), expected.imag(), 1e-9);
+        }
+    }
+}
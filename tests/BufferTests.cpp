@@ -1,19 +1,21 @@
 #include <gtest/gtest.h>
 #include "Heph/Buffers/Buffer.h"
 #include "Heph/Buffers/Iterators/CircularBufferIterator.h"
+#include <memory_resource>
 
 using namespace Heph;
 using test_data_t = int;
 
 template<
     size_t NDimensions,
-    template<typename, size_t> typename TIterator = BufferIterator
+    template<typename, size_t> typename TIterator = BufferIterator,
+    template<typename> typename TAllocator = BufferAllocator
 >
     requires (NDimensions > 0 && NDimensions <= 2)
-class TestBuffer : public Buffer<test_data_t, NDimensions, TIterator>
+class TestBuffer : public Buffer<test_data_t, NDimensions, TIterator, TAllocator>
 {
 public:
-    using Base = Buffer<test_data_t, NDimensions, TIterator>;
+    using Base = Buffer<test_data_t, NDimensions, TIterator, TAllocator>;
     using typename Base::iterator;
     using typename Base::const_iterator;
     using typename Base::buffer_size_t;
@@ -222,6 +224,271 @@ TEST(HephTest, Buffer_Move)
     }
 }
 
+TEST(HephTest, Buffer_Capacity)
+{
+    TestBuffer<1> b1 = { 1, 2, 3 };
+    EXPECT_EQ(b1.Capacity(), 3);
+
+    b1.Reserve(2);
+    EXPECT_EQ(b1.Capacity(), 3);
+
+    b1.Reserve(100);
+    EXPECT_EQ(b1.Capacity(), 100);
+    EXPECT_EQ(b1.Size(), 3);
+    EXPECT_EQ(b1[0], 1);
+    EXPECT_EQ(b1[2], 3);
+
+    b1.ShrinkToFit();
+    EXPECT_EQ(b1.Capacity(), 3);
+
+    {
+        const TestBuffer<1> b2 = { 4 };
+        size_t reallocationCount = 0;
+        const test_data_t* pData = &b1[0];
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            b1.Append(b2);
+            if (pData != &b1[0])
+            {
+                pData = &b1[0];
+                reallocationCount++;
+            }
+        }
+
+        EXPECT_EQ(b1.Size(), 1003);
+        EXPECT_GE(b1.Capacity(), b1.Size());
+        EXPECT_LT(reallocationCount, 20);
+        EXPECT_EQ(b1[0], 1);
+        EXPECT_EQ(b1[2], 3);
+        EXPECT_EQ(b1[1002], 4);
+    }
+
+    {
+        const size_t capacity = b1.Capacity();
+
+        b1.Resize(10);
+        EXPECT_EQ(b1.Size(), 10);
+        EXPECT_EQ(b1.Capacity(), capacity);
+
+        b1.Resize(20);
+        EXPECT_EQ(b1.Capacity(), capacity);
+        EXPECT_EQ(b1[9], 4);
+        EXPECT_EQ(b1[10], 0);
+        EXPECT_EQ(b1[19], 0);
+
+        b1 = { 5, 6 };
+        EXPECT_EQ(b1.Capacity(), capacity);
+
+        b1.ShrinkToFit();
+        EXPECT_EQ(b1.Capacity(), 2);
+        EXPECT_EQ(b1[0], 5);
+        EXPECT_EQ(b1[1], 6);
+    }
+
+    {
+        TestBuffer<2> b2(2, 3);
+        b2.Reserve(60);
+        b2.Append(b2);
+        EXPECT_EQ(b2.Size(), (TestBuffer<2>::buffer_size_t{ 4, 3 }));
+        EXPECT_EQ(b2.Capacity(), 60);
+    }
+}
+
+TEST(HephTest, Buffer_FrontCapacity)
+{
+    // number of elements that keep the first element aligned when it is moved by them
+    constexpr size_t step = HEPH_BUFFER_ALIGNMENT / sizeof(test_data_t);
+    const auto isAligned = [](const test_data_t* p) { return (reinterpret_cast<uintptr_t>(p) % HEPH_BUFFER_ALIGNMENT) == 0; };
+
+    {
+        TestBuffer<1> b1 = { 1, 2, 3 };
+        const TestBuffer<1> b2 = { 4 };
+        size_t reallocationCount = 0;
+        const test_data_t* pData = &b1[0];
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            b1.Prepend(b2);
+            if (pData != &b1[1])
+            {
+                // the first element is realigned when the front capacity is grown
+                reallocationCount++;
+                EXPECT_TRUE(isAligned(&b1[0]));
+            }
+            pData = &b1[0];
+        }
+
+        EXPECT_EQ(b1.Size(), 1003);
+        EXPECT_LT(reallocationCount, 20);
+        EXPECT_EQ(b1[0], 4);
+        EXPECT_EQ(b1[999], 4);
+        EXPECT_EQ(b1[1000], 1);
+        EXPECT_EQ(b1[1002], 3);
+
+        const size_t frontCapacity = b1.FrontCapacity();
+        b1.Cut(0, 1000);
+        EXPECT_EQ(&b1[0], pData + 1000);
+        EXPECT_EQ(b1.FrontCapacity(), frontCapacity + 1000);
+        EXPECT_EQ(b1.Size(), 3);
+        EXPECT_EQ(b1[0], 1);
+        EXPECT_EQ(b1[2], 3);
+
+        b1.Prepend(b1);
+        EXPECT_EQ(&b1[0], pData + 997);
+        EXPECT_EQ(b1.Size(), 6);
+        for (size_t i = 0; i < b1.Size(); ++i)
+            EXPECT_EQ(b1[i], (i % 3) + 1);
+
+        b1.Append(b2);
+        EXPECT_EQ(b1.Size(), 7);
+        EXPECT_EQ(b1[0], 1);
+        EXPECT_EQ(b1[6], 4);
+
+        b1.ShrinkToFit();
+        EXPECT_EQ(b1.FrontCapacity(), 0);
+        EXPECT_EQ(b1.Capacity(), 7);
+        EXPECT_EQ(b1[0], 1);
+        EXPECT_EQ(b1[6], 4);
+    }
+
+    {
+        TestBuffer<2> b1 = { {1, 2}, {3, 4} };
+        b1.ReserveFront(4);
+        EXPECT_EQ(b1.FrontCapacity(), 4);
+
+        const test_data_t* pData = &b1[0, 0];
+        b1.Prepend(TestBuffer<2>({ {5, 6}, {7, 8} }));
+        EXPECT_EQ((&b1[0, 0]), pData - 4);
+        EXPECT_EQ(b1.FrontCapacity(), 0);
+        EXPECT_EQ(b1, TestBuffer<2>({ {5, 6}, {7, 8}, {1, 2}, {3, 4} }));
+
+        b1.Cut(0, 1);
+        EXPECT_EQ(b1, TestBuffer<2>({ {7, 8}, {1, 2}, {3, 4} }));
+        EXPECT_EQ(b1.FrontCapacity(), 2);
+    }
+}
+
+TEST(HephTest, Buffer_Allocator)
+{
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocationCount = 0;
+        size_t deallocationCount = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            this->allocationCount++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            this->deallocationCount++;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    {
+        CountingResource resource;
+
+        {
+            using PmrTestBuffer = TestBuffer<1, BufferIterator, std::pmr::polymorphic_allocator>;
+            PmrTestBuffer b1({ 1, 2, 3 }, &resource);
+            PmrTestBuffer b2(&resource);
+
+            EXPECT_EQ(b1.Allocator().resource(), &resource);
+            EXPECT_EQ(resource.allocationCount, 1);
+
+            b2 = { 4, 5 };
+            b1.Append(b2);
+            EXPECT_EQ(b1.Size(), 5);
+            for (size_t i = 0; i < b1.Size(); ++i)
+                EXPECT_EQ(b1[i], i + 1);
+
+            b2 = std::move(b1);
+            EXPECT_TRUE(b1.IsEmpty());
+            EXPECT_EQ(b2.Size(), 5);
+        }
+
+        EXPECT_GT(resource.allocationCount, 0);
+        EXPECT_EQ(resource.allocationCount, resource.deallocationCount);
+    }
+
+    {
+        TestBuffer<2, BufferIterator, std::allocator> b = { {1, 2}, {3, 4} };
+        b.Append(b);
+        b.Cut(1, 2);
+        b.Resize(2, 3);
+
+        constexpr test_data_t expected[2][3] = { {1, 2, 0}, {3, 4, 0} };
+        for (size_t i = 0; i < b.Size(0); ++i)
+            for (size_t j = 0; j < b.Size(1); ++j)
+                EXPECT_EQ((b[i, j]), expected[i][j]);
+    }
+}
+
+template<typename T>
+using Aligned256Allocator = AlignedBufferAllocator<T, 256>;
+
+TEST(HephTest, Buffer_Alignment)
+{
+    const auto isAligned = [](const test_data_t* ptr, size_t alignment) { return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0; };
+
+    {
+        TestBuffer<1> b1 = { 1, 2, 3 };
+        const TestBuffer<1> b2(1000);
+        EXPECT_TRUE(isAligned(&b1[0], HEPH_BUFFER_ALIGNMENT));
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            b1.Append(b2);
+            EXPECT_TRUE(isAligned(&b1[0], HEPH_BUFFER_ALIGNMENT));
+        }
+        EXPECT_EQ(b1[0], 1);
+        EXPECT_EQ(b1[2], 3);
+
+        b1.Prepend(b2);
+        b1.ShrinkToFit();
+        EXPECT_TRUE(isAligned(&b1[0], HEPH_BUFFER_ALIGNMENT));
+
+        b1.Insert(b2, 5);
+        EXPECT_TRUE(isAligned(&b1[0], HEPH_BUFFER_ALIGNMENT));
+
+        b1.Resize(10);
+        EXPECT_TRUE(isAligned(&b1[0], HEPH_BUFFER_ALIGNMENT));
+
+        b1.Resize(100000);
+        EXPECT_TRUE(isAligned(&b1[0], HEPH_BUFFER_ALIGNMENT));
+    }
+
+    {
+        TestBuffer<2> b = { {1, 2, 3}, {4, 5, 6} };
+        b.Transpose(TransposeMode::Normal, 1, 0);
+        EXPECT_TRUE(isAligned(&b[0, 0], HEPH_BUFFER_ALIGNMENT));
+        EXPECT_EQ((b[2, 1]), 6);
+    }
+
+    {
+        TestBuffer<1, BufferIterator, Aligned256Allocator> b = { 1, 2, 3 };
+        for (size_t i = 0; i < 20; ++i)
+        {
+            b.Append(b);
+            EXPECT_TRUE(isAligned(&b[0], 256));
+        }
+
+        for (size_t i = 0; i < b.Size(); ++i)
+            EXPECT_EQ(b[i], (i % 3) + 1);
+    }
+}
+
 TEST(HephTest, Buffer_Circular)
 {
     {
@@ -250,6 +517,121 @@ TEST(HephTest, Buffer_Circular)
             }
         }
     }
+
+    {
+        constexpr test_data_t expected[10] = { 1, 2, 3, 4, 5, 1, 2, 3, 4, 5 };
+        TestBuffer<1, CircularBufferIterator> b = { 1, 2, 3, 4, 5 };
+
+        auto it = b.cbegin();
+        for (size_t i = 0; i < 10; ++i, --it)
+            EXPECT_EQ(*it, expected[(10 - i) % 5]);
+    }
+
+    {
+        constexpr test_data_t expected[8] = { 1, 2, 3, 4, 1, 2, 3, 4 };
+        TestBuffer<1, PowerOfTwoCircularBufferIterator> b = { 1, 2, 3, 4 };
+
+        auto it = b.cend() - 1;
+        for (size_t i = 0; i < 8; ++i, --it)
+        {
+            EXPECT_EQ(b[i], expected[i]);
+            EXPECT_EQ(b.At(i), expected[i]);
+            EXPECT_EQ(*it, expected[7 - i]);
+        }
+
+        TestBuffer<1, PowerOfTwoCircularBufferIterator> b2(3);
+        EXPECT_THROW(b2.At(0), InvalidOperationException);
+        EXPECT_THROW(b2.begin(), InvalidOperationException);
+
+        TestBuffer<1, PowerOfTwoCircularBufferIterator> empty;
+        EXPECT_EQ(empty.begin(), empty.end());
+    }
+
+    {
+        constexpr test_data_t expected[8][2] = { {1, 2}, {3, 4}, {5, 6}, {7, 8}, {1, 2}, {3, 4}, {5, 6}, {7, 8} };
+        TestBuffer<2, PowerOfTwoCircularBufferIterator> b = { {1, 2}, {3, 4}, {5, 6}, {7, 8} };
+
+        auto it = b.cend() - 1;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            for (size_t j = 0; j < 2; ++j, --it)
+            {
+                EXPECT_EQ((b[i, j]), expected[i][j]);
+                EXPECT_EQ(*it, expected[7 - i][1 - j]);
+            }
+        }
+
+        it = b.cbegin() + 13;
+        EXPECT_EQ(*it, 6);
+        it -= 14;
+        EXPECT_EQ(*it, 8);
+    }
+}
+
+TEST(HephTest, Buffer_Iterator)
+{
+    static_assert(std::contiguous_iterator<TestBuffer<1>::iterator>);
+    static_assert(std::contiguous_iterator<TestBuffer<1>::const_iterator>);
+    static_assert(std::random_access_iterator<TestBuffer<2>::iterator>);
+    static_assert(std::random_access_iterator<TestBuffer<2, CircularBufferIterator>::iterator>);
+    static_assert(std::random_access_iterator<BufferView<test_data_t>::iterator>);
+
+    {
+        TestBuffer<1> b = { 5, 3, 1, 4, 2 };
+        std::sort(b.begin(), b.end());
+        EXPECT_EQ(b, TestBuffer<1>({ 1, 2, 3, 4, 5 }));
+
+        EXPECT_EQ(b.end() - b.begin(), 5);
+        EXPECT_EQ(std::to_address(b.begin() + 2), &b[2]);
+        EXPECT_EQ(b.begin()[3], 4);
+        EXPECT_TRUE(b.begin() < b.end());
+    }
+
+    {
+        TestBuffer<2> b = { {1, 2, 3}, {4, 5, 6} };
+
+        auto it = b.begin();
+        EXPECT_EQ(b.end() - it, 6);
+        EXPECT_EQ(it[4], 5);
+        EXPECT_EQ(*(2 + it), 3);
+
+        it += 5;
+        EXPECT_EQ(*it, 6);
+        EXPECT_EQ(*(it + -3), 3);
+        EXPECT_EQ(*(it - 4), 2);
+        EXPECT_EQ(*(it - 2), 4);
+        EXPECT_EQ(*(it - 5), 1);
+        EXPECT_EQ(*(it++), 6);
+        EXPECT_EQ(it, b.end());
+        EXPECT_TRUE(b.begin() < it);
+        EXPECT_TRUE(b.begin() + 3 >= b.begin() + 3);
+
+        std::sort(b.begin(), b.end(), std::greater<test_data_t>());
+        EXPECT_EQ(b, TestBuffer<2>({ {6, 5, 4}, {3, 2, 1} }));
+    }
+
+    {
+        constexpr test_data_t expected[12] = { 1, 5, 9, 2, 6, 10, 3, 7, 11, 4, 8, 12 };
+        TestBuffer<2> b = { {1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12} };
+        b.Transpose(TransposeMode::InPlace, 1, 0);
+
+        size_t i = 0;
+        for (auto it = b.cbegin(); it != b.cend(); ++it, ++i)
+            EXPECT_EQ(*it, expected[i]);
+        EXPECT_EQ(i, 12);
+
+        auto it = b.cend();
+        for (i = 12; i > 0; --i)
+            EXPECT_EQ(*(--it), expected[i - 1]);
+        EXPECT_EQ(it, b.cbegin());
+
+        it += 10;
+        EXPECT_EQ(*it, expected[10]);
+        EXPECT_EQ(it.Indices(), (std::array<index_t, 2>{ 3, 1 }));
+        it -= 8;
+        EXPECT_EQ(*it, expected[2]);
+        EXPECT_EQ(it.Indices(), (std::array<index_t, 2>{ 0, 2 }));
+    }
 }
 
 TEST(HephTest, Buffer_Reset)
@@ -709,6 +1091,25 @@ TEST(HephTest, Buffer_Cut)
         EXPECT_EQ(b.ElementCount(), 0);
         EXPECT_TRUE(b.IsEmpty());
     }
+    {
+        TestBuffer<1> b = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        const test_data_t* pData = &b[0];
+
+        b.Cut(5, 2);
+        EXPECT_EQ(&b[0], pData);
+        EXPECT_EQ(b.Capacity(), 8);
+        EXPECT_EQ(b, TestBuffer<1>({ 1, 2, 3, 4, 5, 8 }));
+
+        b.Cut(1, 2);
+        EXPECT_EQ(&b[0], pData + 2);
+        EXPECT_EQ(b.FrontCapacity(), 2);
+        EXPECT_EQ(b, TestBuffer<1>({ 1, 4, 5, 8 }));
+
+        b.ShrinkToFit();
+        EXPECT_EQ(b.Capacity(), 4);
+        EXPECT_EQ(b.FrontCapacity(), 0);
+        EXPECT_EQ(b, TestBuffer<1>({ 1, 4, 5, 8 }));
+    }
 }
 
 TEST(HephTest, Buffer_Replace)
@@ -773,6 +1174,35 @@ TEST(HephTest, Buffer_Replace)
     }
 }
 
+TEST(HephTest, Buffer_StridedCopy)
+{
+    TestBuffer<2> b = { {1, 2, 3}, {4, 5, 6} };
+    b.Transpose(TransposeMode::InPlace, 1, 0);
+    EXPECT_EQ(b, TestBuffer<2>({ {1, 4}, {2, 5}, {3, 6} }));
+
+    b <<= 1;
+    EXPECT_EQ(b, TestBuffer<2>({ {2, 5}, {3, 6}, {0, 0} }));
+
+    b.Replace(b, 1, 0, 2);
+    EXPECT_EQ(b, TestBuffer<2>({ {2, 5}, {2, 5}, {3, 6} }));
+
+    b.Replace(b, 0, 1, 2);
+    EXPECT_EQ(b, TestBuffer<2>({ {2, 5}, {3, 6}, {3, 6} }));
+
+    b >>= 2;
+    EXPECT_EQ(b, TestBuffer<2>({ {0, 0}, {0, 0}, {2, 5} }));
+
+    TestBuffer<2> copy = b;
+    EXPECT_EQ(copy, TestBuffer<2>({ {0, 0}, {0, 0}, {2, 5} }));
+    EXPECT_EQ(copy.SubBuffer(2, 2), TestBuffer<2>({ {2, 5}, {0, 0} }));
+
+    TestBuffer<1> b1 = { 1, 2, 3, 4, 5 };
+    b1.Replace(b1, 1, 0, 4);
+    EXPECT_EQ(b1, TestBuffer<1>({ 1, 1, 2, 3, 4 }));
+    b1.Replace(b1, 0, 2, 3);
+    EXPECT_EQ(b1, TestBuffer<1>({ 2, 3, 4, 3, 4 }));
+}
+
 TEST(HephTest, Buffer_Transpose)
 {
     {
@@ -811,6 +1241,60 @@ TEST(HephTest, Buffer_Transpose)
             for (size_t j = 0; j < b.Size(1); ++j)
                 EXPECT_EQ((b[i, j]), expected[i][j]);
     }
+
+    {
+        constexpr size_t rowCount = 300;
+        constexpr size_t colCount = 700;
+
+        TestBuffer<2> b(rowCount, colCount);
+        for (size_t i = 0; i < rowCount; ++i)
+            for (size_t j = 0; j < colCount; ++j)
+                b[i, j] = i * colCount + j;
+
+        Parallel::SetThreadCount(4);
+        b.Transpose(TransposeMode::Normal, 1, 0);
+        Parallel::SetThreadCount(0);
+
+        EXPECT_EQ(b.Size(0), colCount);
+        EXPECT_EQ(b.Size(1), rowCount);
+        EXPECT_TRUE(b.IsContiguous());
+
+        for (size_t i = 0; i < colCount; ++i)
+            for (size_t j = 0; j < rowCount; ++j)
+                EXPECT_EQ((b[i, j]), j * colCount + i);
+    }
+}
+
+TEST(HephTest, Buffer_MakeContiguous)
+{
+    {
+        TestBuffer<2> b = { {1, 2, 3}, {4, 5, 6} };
+        EXPECT_TRUE(b.IsContiguous());
+
+        b.Transpose(TransposeMode::InPlace, 1, 0);
+        EXPECT_FALSE(b.IsContiguous());
+
+        b.MakeContiguous();
+        EXPECT_TRUE(b.IsContiguous());
+        EXPECT_EQ(b, TestBuffer<2>({ {1, 4}, {2, 5}, {3, 6} }));
+        EXPECT_EQ((&b[1, 0]), (&b[0, 0] + 2));
+    }
+
+    {
+        TestBuffer<2> b(70, 45);
+        for (size_t i = 0; i < b.Size(0); ++i)
+            for (size_t j = 0; j < b.Size(1); ++j)
+                b[i, j] = i * 100 + j;
+
+        b.Transpose(TransposeMode::InPlace, 1, 0);
+        b.MakeContiguous();
+        EXPECT_TRUE(b.IsContiguous());
+        EXPECT_EQ(b.Size(), (TestBuffer<2>::buffer_size_t{ 45, 70 }));
+
+        for (size_t i = 0; i < b.Size(0); ++i)
+            for (size_t j = 0; j < b.Size(1); ++j)
+                EXPECT_EQ((b[i, j]), j * 100 + i);
+    }
 }
 
 TEST(HephTest, Buffer_Resize)
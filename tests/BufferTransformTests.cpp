@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/ArithmeticBuffer.h"
+#include "Heph/Buffers/BufferTransform.h"
+#include <cmath>
+#include <thread>
+
+using namespace Heph;
+using test_data_t = double;
+template<size_t NDims>
+using TransformTestBuffer = ArithmeticBuffer<test_data_t, NDims>;
+
+TEST(HephTest, BufferTransform_Transform)
+{
+    {
+        const TransformTestBuffer<1> a = { 1, 2, 3, 4 };
+        const ArithmeticBuffer<int32_t, 1> b = { 10, 20, 30, 40 };
+        TransformTestBuffer<1> result(4);
+
+        BufferTransform::Transform(result.View(), [](double x, int32_t y) { return x * y + 1; }, a.View(), b.View());
+        EXPECT_EQ(result, TransformTestBuffer<1>({ 11, 41, 91, 161 }));
+
+        BufferTransform::Transform(result.View(), [](double x, double y, double z) { return x + y - z; }, a.View(), a.View(), result.View());
+        EXPECT_EQ(result, TransformTestBuffer<1>({ -9, -37, -85, -153 }));
+
+        size_t counter = 0;
+        BufferTransform::Transform(result.View(), [&counter]() { return static_cast<double>(++counter); });
+        EXPECT_EQ(counter, 4);
+
+        EXPECT_THROW(BufferTransform::Transform(result.View(), [](double x) { return x; }, TransformTestBuffer<1>(3).View()), InvalidArgumentException);
+    }
+
+    {
+        // strided and broadcast sources
+        const TransformTestBuffer<2> a = { {1, 2, 3}, {4, 5, 6} };
+        const TransformTestBuffer<2> column = { {10, 0}, {20, 0} };
+        const TransformTestBuffer<2> row = { {1, -1, 1} };
+        TransformTestBuffer<2> result(2, 3);
+
+        BufferTransform::Transform(result.View(), [](double x, double c, double r) { return (x + c) * r; }, a.View(), column.Slice(1, 0, 1), row.View());
+        EXPECT_EQ(result, (TransformTestBuffer<2>({ {11, -12, 13}, {24, -25, 26} })));
+
+        // strided destination
+        TransformTestBuffer<2> wide(2, 6);
+        BufferTransform::Transform(wide.Slice(1, 1, 3, 2), [](double x) { return x * 2; }, a.View());
+        EXPECT_EQ(wide, (TransformTestBuffer<2>({ {0, 2, 0, 4, 0, 6}, {0, 8, 0, 10, 0, 12} })));
+    }
+}
+
+TEST(HephTest, BufferTransform_Apply)
+{
+    {
+        TransformTestBuffer<1> b = { 1, 4, 9, 16 };
+        b.Apply([](double x) { return std::sqrt(x); });
+        EXPECT_EQ(b, TransformTestBuffer<1>({ 1, 2, 3, 4 }));
+
+        BufferTransform::Apply(b.Slice(0, 0, 2, 2), [](double x) { return -x; });
+        EXPECT_EQ(b, TransformTestBuffer<1>({ -1, 2, -3, 4 }));
+    }
+
+    {
+        // large enough to be split across threads, with a layout that is not contiguous
+        Parallel::SetThreadCount(4);
+
+        TransformTestBuffer<3> b(64, 32, 96);
+        size_t i = 0;
+        for (test_data_t& element : b) element = static_cast<test_data_t>(i++);
+
+        b.Transpose(TransposeMode::InPlace, 0, 2, 1);
+        EXPECT_FALSE(b.IsContiguous());
+        b.Apply([](double x) { return std::tanh(x * 1e-5); });
+
+        i = 0;
+        b.Transpose(TransposeMode::InPlace, 0, 2, 1);
+        for (const test_data_t& element : b)
+            EXPECT_EQ(element, std::tanh(static_cast<test_data_t>(i++) * 1e-5));
+
+        TransformTestBuffer<1> flat(1uz << 18);
+        flat.Apply([](double) { return 1.0; });
+        EXPECT_EQ(flat.Min(), 1);
+
+        Parallel::SetThreadCount(0);
+    }
+}
+
+TEST(HephTest, BufferTransform_ExecutionPolicy)
+{
+    Parallel::SetThreadCount(4);
+
+    TransformTestBuffer<2> b(512, 1024);
+    const std::thread::id callerId = std::this_thread::get_id();
+
+    // sequenced policies stay on the calling thread and visit the elements in row-major order
+    double previous = -1;
+    BufferTransform::Transform(Execution::seq, b.View(), [&previous, callerId]()
+        {
+            EXPECT_EQ(std::this_thread::get_id(), callerId);
+            return ++previous;
+        });
+    EXPECT_EQ((b[511, 1023]), 512 * 1024 - 1);
+
+    b.Apply(Execution::unseq, [callerId](double x)
+        {
+            EXPECT_EQ(std::this_thread::get_id(), callerId);
+            return x * 2;
+        });
+    EXPECT_EQ((b[1, 0]), 2048);
+
+    BufferTransform::Apply(Execution::par, b.View(), [](double x) { return x + 1; });
+    EXPECT_EQ((b[1, 0]), 2049);
+
+    size_t callCount = 0;
+    Parallel::For(Execution::seq, 0, 1uz << 20, 1, [&callCount](size_t begin, size_t end)
+        {
+            EXPECT_EQ(begin, 0);
+            EXPECT_EQ(end, 1uz << 20);
+            callCount++;
+        });
+    EXPECT_EQ(callCount, 1);
+
+    Parallel::SetThreadCount(0);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/ArithmeticBuffer.h"
+
+using namespace Heph;
+using test_data_t = double;
+template<size_t NDims>
+using ViewTestBuffer = ArithmeticBuffer<test_data_t, NDims>;
+
+TEST(HephTest, BufferView_Slice)
+{
+    {
+        ViewTestBuffer<1> b = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+        BufferView<test_data_t> view = b.Slice(0, 1, 4, 2);
+        EXPECT_EQ(view.Data(), &b[1]);
+        EXPECT_EQ(view.Size(), 4);
+        EXPECT_EQ(view.Strides(), 2);
+        EXPECT_EQ(view, ViewTestBuffer<1>({ 2, 4, 6, 8 }).View());
+
+        view[1] = 10;
+        EXPECT_EQ(b[3], 10);
+
+        const BufferView<test_data_t> subView = view.Slice(0, 1, 2, 2);
+        EXPECT_EQ(subView.Size(), 2);
+        EXPECT_EQ(subView[0], 10);
+        EXPECT_EQ(subView[1], 8);
+
+        EXPECT_EQ(view.At(3), 8);
+        EXPECT_THROW(view.At(4), InvalidArgumentException);
+        EXPECT_THROW(view.Slice(0, 1, 4, 2), InvalidArgumentException);
+        EXPECT_THROW(view.Slice(0, 0, 1, 0), InvalidArgumentException);
+        EXPECT_THROW(view.Slice(1, 0, 1), InvalidArgumentException);
+        EXPECT_TRUE(view.Slice(0, 4, 0).IsEmpty());
+    }
+
+    {
+        ViewTestBuffer<2> b = { {1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12} };
+
+        const BufferView<const test_data_t, 2> column = b.Slice(1, 1, 1);
+        EXPECT_EQ(column.Size(), (BufferView<const test_data_t, 2>::buffer_size_t{ 4, 1 }));
+        EXPECT_EQ((column[0, 0]), 2);
+        EXPECT_EQ((column[3, 0]), 11);
+
+        const BufferView<const test_data_t, 2> rows = b.Slice(0, 0, 2, 2).Slice(1, 0, 2, 2);
+        EXPECT_EQ(rows.ElementCount(), 4);
+
+        const ViewTestBuffer<2> copy(rows);
+        EXPECT_EQ(copy, ViewTestBuffer<2>({ {1, 3}, {7, 9} }));
+
+        size_t i = 0;
+        constexpr test_data_t expected[4] = { 1, 3, 7, 9 };
+        for (const test_data_t& element : rows)
+            EXPECT_EQ(element, expected[i++]);
+        EXPECT_EQ(i, 4);
+    }
+}
+
+TEST(HephTest, BufferView_BroadcastTo)
+{
+    {
+        ViewTestBuffer<1> b = { 5 };
+
+        const BufferView<test_data_t> view = b.View().BroadcastTo(4);
+        EXPECT_EQ(view.Size(), 4);
+        EXPECT_EQ(view.Strides(), 0);
+        for (size_t i = 0; i < view.Size(); ++i)
+            EXPECT_EQ(view[i], 5);
+
+        size_t count = 0;
+        for (const test_data_t& element : view)
+        {
+            EXPECT_EQ(element, 5);
+            ++count;
+        }
+        EXPECT_EQ(count, 4);
+        EXPECT_EQ(view.end() - view.begin(), 4);
+
+        EXPECT_EQ(ViewTestBuffer<1>(view), ViewTestBuffer<1>({ 5, 5, 5, 5 }));
+        EXPECT_NE(view, ViewTestBuffer<1>({ 1, 2, 3, 4 }).View());
+        EXPECT_THROW(ViewTestBuffer<1>({ 1, 2 }).View().BroadcastTo(4), InvalidArgumentException);
+    }
+
+    {
+        const ViewTestBuffer<1> b = { 1, 2, 3 };
+
+        const BufferView<const test_data_t, 2> rows = b.View().BroadcastTo<2>({ 2, 3 });
+        EXPECT_EQ(rows.Strides(), (BufferView<const test_data_t, 2>::buffer_size_t{ 0, 1 }));
+        EXPECT_EQ(ViewTestBuffer<2>(rows), (ViewTestBuffer<2>({ {1, 2, 3}, {1, 2, 3} })));
+        EXPECT_THROW(b.View().BroadcastTo<2>({ 3, 2 }), InvalidArgumentException);
+    }
+
+    {
+        const ViewTestBuffer<2> b = { {1}, {2} };
+
+        const BufferView<const test_data_t, 2> columns = b.View().BroadcastTo({ 2, 3 });
+        EXPECT_FALSE(columns.IsContiguous());
+        EXPECT_EQ(ViewTestBuffer<2>(columns), (ViewTestBuffer<2>({ {1, 1, 1}, {2, 2, 2} })));
+
+        const BufferView<const test_data_t, 3> planes = b.View().BroadcastTo<3>({ 2, 2, 2 });
+        EXPECT_EQ((planes[1, 1, 0]), 2);
+        EXPECT_EQ((planes[1, 0, 1]), 1);
+        EXPECT_TRUE(b.View().BroadcastTo<3>({ 0, 2, 1 }).IsEmpty());
+    }
+}
+
+TEST(HephTest, BufferView_Arithmetic)
+{
+    {
+        ViewTestBuffer<1> b1 = { 1, 2, 3, 4, 5, 6 };
+        const ViewTestBuffer<1> b2 = { 1, 1, 1 };
+
+        ViewTestBuffer<1> result = b2 + b1.Slice(0, 0, 3, 2);
+        EXPECT_EQ(result, ViewTestBuffer<1>({ 2, 4, 6 }));
+
+        result *= b1.Slice(0, 3, 3);
+        EXPECT_EQ(result, ViewTestBuffer<1>({ 8, 20, 36 }));
+
+        result -= b2.View();
+        EXPECT_EQ(result, ViewTestBuffer<1>({ 7, 19, 35 }));
+
+        result /= b1.Slice(0, 0, 3);
+        EXPECT_EQ(result[0], 7);
+        EXPECT_EQ(result[1], 9.5);
+
+        EXPECT_THROW(result += b1.View(), InvalidOperationException);
+    }
+
+    {
+        const ViewTestBuffer<1> b = { 1, -65, 27, 31, 18, 3 };
+        EXPECT_EQ(ViewTestBuffer<1>::Min(b.Slice(0, 2, 4)), 3);
+        EXPECT_EQ(ViewTestBuffer<1>::Max(b.Slice(0, 0, 3, 2)), 27);
+        EXPECT_EQ(ViewTestBuffer<1>::AbsMax(b.Slice(0, 1, 5)), 65);
+        EXPECT_NEAR(ViewTestBuffer<1>::Rms(b.Slice(0, 0, 2)), 45.97, 0.005);
+    }
+
+    {
+        const ViewTestBuffer<2> b = { {1, -65}, {27, 31}, {18, 3} };
+        EXPECT_EQ(ViewTestBuffer<2>::Min(b.Slice(1, 0, 1)), 1);
+        EXPECT_EQ(ViewTestBuffer<2>::Max(b.Slice(1, 1, 1)), 31);
+    }
+}
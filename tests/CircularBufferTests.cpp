@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/CircularBuffer.h"
+#include <vector>
+
+using namespace Heph;
+using test_data_t = int;
+
+TEST(HephTest, CircularBuffer_PushPop)
+{
+    {
+        CircularBuffer<test_data_t> cb(4);
+        EXPECT_EQ(cb.Capacity(), 4);
+        EXPECT_TRUE(cb.IsEmpty());
+        EXPECT_THROW(cb.Pop(), InvalidOperationException);
+
+        EXPECT_TRUE(cb.Push(1));
+        EXPECT_TRUE(cb.Push(2));
+        EXPECT_TRUE(cb.Push(3));
+        EXPECT_EQ(cb.Pop(), 1);
+        EXPECT_EQ(cb.Pop(), 2);
+
+        // wraps around the end of the storage
+        const Buffer<test_data_t> frame = { 4, 5, 6, 7 };
+        EXPECT_EQ(cb.Push(frame.View()), 3);
+        EXPECT_TRUE(cb.IsFull());
+        EXPECT_FALSE(cb.Push(8));
+
+        EXPECT_EQ(cb.Peek(), 3);
+        EXPECT_EQ(cb[1], 4);
+        EXPECT_EQ(cb.At(3), 6);
+        EXPECT_THROW(cb.At(4), InvalidArgumentException);
+
+        std::vector<test_data_t> elements(cb.begin(), cb.end());
+        EXPECT_EQ(elements, (std::vector<test_data_t>{ 3, 4, 5, 6 }));
+
+        Buffer<test_data_t> dest(3);
+        EXPECT_EQ(cb.Peek(dest.View(), 2), 2);
+        EXPECT_EQ(dest, Buffer<test_data_t>({ 5, 6, 0 }));
+
+        EXPECT_EQ(cb.Pop(dest.View()), 3);
+        EXPECT_EQ(dest, Buffer<test_data_t>({ 3, 4, 5 }));
+        EXPECT_EQ(cb.Count(), 1);
+        EXPECT_EQ(cb.Pop(), 6);
+        EXPECT_TRUE(cb.IsEmpty());
+    }
+
+    {
+        CircularBuffer<test_data_t> cb(4, CircularBufferOverflowMode::OverwriteOldest);
+        const Buffer<test_data_t> frame = { 1, 2, 3 };
+
+        EXPECT_EQ(cb.Push(frame.View()), 3);
+        EXPECT_EQ(cb.Push(frame.View()), 3);
+        EXPECT_EQ(cb.Count(), 4);
+        EXPECT_EQ(std::vector<test_data_t>(cb.begin(), cb.end()), (std::vector<test_data_t>{ 3, 1, 2, 3 }));
+
+        const Buffer<test_data_t> large = { 10, 11, 12, 13, 14, 15 };
+        EXPECT_EQ(cb.Push(large.Slice(0, 0, 6)), 4);
+        EXPECT_EQ(std::vector<test_data_t>(cb.begin(), cb.end()), (std::vector<test_data_t>{ 12, 13, 14, 15 }));
+
+        EXPECT_EQ(cb.Discard(3), 3);
+        EXPECT_EQ(cb.Peek(), 15);
+        cb.Clear();
+        EXPECT_TRUE(cb.IsEmpty());
+    }
+}
+
+TEST(HephTest, CircularBuffer_Frames)
+{
+    CircularBuffer<test_data_t, 2> cb(3, 2);
+    EXPECT_EQ(cb.EntryElementCount(), 2);
+
+    const Buffer<test_data_t, 2> frames = { {1, 2}, {3, 4} };
+    EXPECT_EQ(cb.Push(frames.View()), 2);
+    EXPECT_EQ(cb.Push(frames.View()), 1);
+    EXPECT_EQ(cb.Size(), (CircularBuffer<test_data_t, 2>::buffer_size_t{ 3, 2 }));
+
+    Buffer<test_data_t, 2> dest(2, 2);
+    EXPECT_EQ(cb.Pop(dest.View()), 2);
+    EXPECT_EQ(dest, (Buffer<test_data_t, 2>({ {1, 2}, {3, 4} })));
+
+    EXPECT_EQ(cb.Push(frames.View()), 2);
+    EXPECT_EQ((cb[0, 1]), 2);
+    EXPECT_EQ((cb.At(2, 0)), 3);
+    EXPECT_THROW((cb.At(1, 2)), InvalidArgumentException);
+
+    std::vector<test_data_t> elements(cb.begin(), cb.end());
+    EXPECT_EQ(elements, (std::vector<test_data_t>{ 1, 2, 1, 2, 3, 4 }));
+
+    // pop into the transposed view of a buffer
+    Buffer<test_data_t, 2> transposed(2, 3);
+    const BufferView<test_data_t, 2> view(transposed.View().Data(), { 3, 2 }, { 1, 3 });
+    EXPECT_EQ(cb.Pop(view), 3);
+    EXPECT_EQ(transposed, (Buffer<test_data_t, 2>({ {1, 1, 3}, {2, 2, 4} })));
+
+    const Buffer<test_data_t, 2> wrongSize(1, 3);
+    EXPECT_THROW(cb.Push(wrongSize.View()), InvalidArgumentException);
+}
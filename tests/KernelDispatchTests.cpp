@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/Kernels/KernelDispatch.h"
+#include "Heph/Buffers/Kernels/ArithmeticKernels.h"
+#include <string>
+#include <vector>
+
+using namespace Heph;
+
+TEST(HephTest, KernelDispatch)
+{
+    const InstructionSet initial = KernelDispatch::ActiveInstructionSet();
+    const InstructionSet supported = KernelDispatch::SupportedInstructionSet();
+    EXPECT_LE(initial, supported);
+
+    EXPECT_EQ(std::string(KernelDispatch::InstructionSetName(InstructionSet::Generic)), "generic");
+    EXPECT_EQ(std::string(KernelDispatch::InstructionSetName(InstructionSet::AVX512)), "avx512");
+
+    // wider instruction sets than the CPU supports are lowered
+    EXPECT_EQ(KernelDispatch::SetInstructionSet(InstructionSet::AVX512), supported);
+    EXPECT_EQ(KernelDispatch::ActiveInstructionSet(), supported);
+
+    // every instruction set must give the same results
+    constexpr size_t count = 37;
+    std::vector<float> lhs(count), rhs(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        lhs[i] = static_cast<float>(i) * 0.5f;
+        rhs[i] = static_cast<float>(i % 7 + 1);
+    }
+
+    std::vector<std::complex<double>> complexLhs(count), complexRhs(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        complexLhs[i] = std::complex<double>(i + 1.0, 2.0 - i);
+        complexRhs[i] = std::complex<double>(i % 3 + 1.0, 0.25 * i);
+    }
+
+    for (int i = InstructionSet::Generic; i <= supported; ++i)
+    {
+        const InstructionSet instructionSet = static_cast<InstructionSet>(i);
+        EXPECT_EQ(KernelDispatch::SetInstructionSet(instructionSet), instructionSet);
+        EXPECT_EQ(KernelDispatch::ActiveInstructionSet(), instructionSet);
+
+        std::vector<float> result = lhs;
+        ArithmeticKernels::Add(result.data(), rhs.data(), count);
+        ArithmeticKernels::Multiply(result.data(), 3.0f, count);
+        for (size_t j = 0; j < count; ++j) EXPECT_EQ(result[j], (lhs[j] + rhs[j]) * 3.0f);
+
+        std::vector<std::complex<double>> complexResult = complexLhs;
+        ArithmeticKernels::Multiply(complexResult.data(), complexRhs.data(), count);
+        ArithmeticKernels::Add(complexResult.data(), std::complex<double>(1, -1), count);
+        for (size_t j = 0; j < count; ++j)
+        {
+            const std::complex<double> expected = complexLhs[j] * complexRhs[j] + std::complex<double>(1, -1);
+            EXPECT_NEAR(complexResult[j].real(), expected.real(), 1e-9);
+            EXPECT_NEAR(complexResult[j].imag(), expected.imag(), 1e-9);
+        }
+
+        std::vector<double> widened(count);
+        ArithmeticKernels::Convert(widened.data(), lhs.data(), count);
+        for (size_t j = 0; j < count; ++j) EXPECT_EQ(widened[j], static_cast<double>(lhs[j]));
+
+        std::vector<float> narrowed(count);
+        ArithmeticKernels::Convert(narrowed.data(), widened.data(), count);
+        EXPECT_EQ(narrowed, lhs);
+    }
+
+    KernelDispatch::SetInstructionSet(initial);
+}
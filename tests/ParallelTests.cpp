@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include "Heph/Parallel.h"
+#include <vector>
+#include <stdexcept>
+
+using namespace Heph;
+
+TEST(HephTest, Parallel_For)
+{
+    Parallel::SetThreadCount(4);
+    EXPECT_EQ(Parallel::ThreadCount(), 4);
+
+    {
+        std::vector<int> v(1000, 0);
+        Parallel::For(0, v.size(), 10, [&v](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    v[i] += i;
+            });
+
+        for (size_t i = 0; i < v.size(); ++i)
+            EXPECT_EQ(v[i], i);
+    }
+
+    {
+        size_t callCount = 0;
+        Parallel::For(5, 10, 100, [&callCount](size_t begin, size_t end)
+            {
+                EXPECT_EQ(begin, 5);
+                EXPECT_EQ(end, 10);
+                callCount++;
+            });
+        EXPECT_EQ(callCount, 1);
+
+        Parallel::For(10, 10, 1, [&callCount](size_t, size_t) { callCount++; });
+        EXPECT_EQ(callCount, 1);
+    }
+
+    EXPECT_THROW(Parallel::For(0, 100, 1, [](size_t begin, size_t)
+        {
+            if (begin > 0) throw std::runtime_error("chunk failed");
+        }), std::runtime_error);
+
+    Parallel::SetThreadCount(0);
+    EXPECT_GE(Parallel::ThreadCount(), 1);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/Kernels/ReductionKernels.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Heph;
+
+template<typename T>
+static void TestReductionKernels()
+{
+    // odd count so that both the vector and the scalar tails run
+    constexpr size_t count = 103;
+
+    std::vector<T> data(count);
+    for (size_t i = 0; i < count; ++i)
+        data[i] = static_cast<T>((i * 37) % 101) - static_cast<T>(50);
+    data[61] = static_cast<T>(-77);
+    data[88] = static_cast<T>(64);
+
+    EXPECT_EQ(ReductionKernels::Min(data.data(), count), static_cast<T>(-77));
+    EXPECT_EQ(ReductionKernels::Max(data.data(), count), static_cast<T>(64));
+    EXPECT_EQ(ReductionKernels::AbsMax(data.data(), count), static_cast<T>(77));
+
+    double expected = 0;
+    for (const T& x : data) expected += static_cast<double>(x) * static_cast<double>(x);
+    EXPECT_DOUBLE_EQ(ReductionKernels::SumOfSquares(data.data(), count), expected);
+
+    // NaN elements are skipped
+    data[5] = std::numeric_limits<T>::quiet_NaN();
+    data[count - 1] = std::numeric_limits<T>::quiet_NaN();
+    EXPECT_EQ(ReductionKernels::Min(data.data(), count), static_cast<T>(-77));
+    EXPECT_EQ(ReductionKernels::Max(data.data(), count), static_cast<T>(64));
+    EXPECT_EQ(ReductionKernels::AbsMax(data.data(), count), static_cast<T>(77));
+
+    EXPECT_EQ(ReductionKernels::Min(data.data(), 0), std::numeric_limits<T>::max());
+    EXPECT_EQ(ReductionKernels::Max(data.data(), 0), std::numeric_limits<T>::lowest());
+    EXPECT_EQ(ReductionKernels::SumOfSquares(data.data(), 0), 0.0);
+
+    // statistics must match the element-by-element updates, including the tails of the blocks
+    std::vector<T> values(2500);
+    BufferStatistics<T> expectedStatistics;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<T>((i * 13) % 29) - static_cast<T>(9.5);
+        expectedStatistics.Add(values[i]);
+    }
+
+    const BufferStatistics<T> statistics = ReductionKernels::Statistics(values.data(), values.size());
+    EXPECT_EQ(statistics.count, expectedStatistics.count);
+    EXPECT_EQ(statistics.min, expectedStatistics.min);
+    EXPECT_EQ(statistics.max, expectedStatistics.max);
+    EXPECT_EQ(statistics.absMax, expectedStatistics.absMax);
+    EXPECT_NEAR(statistics.sum, expectedStatistics.sum, 1e-9);
+    EXPECT_NEAR(statistics.mean, expectedStatistics.mean, 1e-12);
+    EXPECT_NEAR(statistics.Variance(), expectedStatistics.Variance(), 1e-9);
+    EXPECT_NEAR(statistics.Rms(), expectedStatistics.Rms(), 1e-9);
+}
+
+TEST(HephTest, ReductionKernels)
+{
+    TestReductionKernels<float>();
+    TestReductionKernels<double>();
+
+    // a naive sum stops growing once the squares are below its precision
+    {
+        constexpr size_t count = 1000003;
+        std::vector<double> data(count, 1e-4);
+        data[0] = 1e8;
+
+        const double expected = 1e16 + (count - 1) * 1e-8;
+        EXPECT_NEAR(ReductionKernels::SumOfSquares(data.data(), count), expected, 2.0);
+    }
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "Heph/Buffers/SPSCRingBuffer.h"
+#include <thread>
+
+using namespace Heph;
+using test_data_t = int;
+
+TEST(HephTest, SPSCRingBuffer_ReadWrite)
+{
+    EXPECT_THROW(SPSCRingBuffer<test_data_t>(0), InvalidArgumentException);
+
+    SPSCRingBuffer<test_data_t> rb(6);
+    EXPECT_EQ(rb.Capacity(), 8);
+    EXPECT_EQ(rb.WriteAvailable(), 8);
+    EXPECT_EQ(rb.ReadAvailable(), 0);
+
+    test_data_t element = 0;
+    EXPECT_FALSE(rb.Read(element));
+
+    const Buffer<test_data_t> src = { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(rb.Write(src.View()), 6);
+
+    Buffer<test_data_t> dest(4);
+    EXPECT_EQ(rb.Read(dest.View()), 4);
+    EXPECT_EQ(dest, Buffer<test_data_t>({ 1, 2, 3, 4 }));
+
+    // wraps around the end of the ring
+    EXPECT_EQ(rb.Write(src.View()), 6);
+    EXPECT_EQ(rb.ReadAvailable(), 8);
+    EXPECT_EQ(rb.Write(src.View()), 0);
+    EXPECT_FALSE(rb.Write(7));
+
+    auto [first, second] = rb.ReadSpans();
+    EXPECT_EQ(first.Size(), 4);
+    EXPECT_EQ(second.Size(), 4);
+    EXPECT_EQ(first[0], 5);
+    EXPECT_EQ(second[0], 3);
+    rb.CommitRead(3);
+
+    EXPECT_TRUE(rb.Read(element));
+    EXPECT_EQ(element, 2);
+
+    auto [free1, free2] = rb.WriteSpans();
+    EXPECT_EQ(free1.Size(), 4);
+    EXPECT_EQ(free2.Size(), 0);
+    free1[0] = 10;
+    free1[1] = 11;
+    rb.CommitWrite(2);
+
+    // read into a strided view
+    Buffer<test_data_t> strided(12);
+    EXPECT_EQ(rb.Read(strided.Slice(0, 0, 6, 2)), 6);
+    EXPECT_EQ(strided, Buffer<test_data_t>({ 3, 0, 4, 0, 5, 0, 6, 0, 10, 0, 11, 0 }));
+    EXPECT_EQ(rb.ReadAvailable(), 0);
+}
+
+TEST(HephTest, SPSCRingBuffer_Threads)
+{
+    constexpr size_t elementCount = 100000;
+    constexpr size_t frameSize = 100;
+    SPSCRingBuffer<test_data_t> rb(256);
+
+    std::thread producer([&]()
+        {
+            Buffer<test_data_t> frame(frameSize);
+            for (size_t i = 0; i < elementCount; i += frameSize)
+            {
+                for (size_t j = 0; j < frameSize; ++j)
+                    frame[j] = i + j;
+
+                size_t written = 0;
+                while (written < frameSize)
+                {
+                    written += rb.Write(frame.Slice(0, written, frameSize - written));
+                    if (written < frameSize) std::this_thread::yield();
+                }
+            }
+        });
+
+    Buffer<test_data_t> frame(64);
+    size_t expected = 0;
+    bool ordered = true;
+    while (expected < elementCount)
+    {
+        const size_t n = rb.Read(frame.View());
+        for (size_t i = 0; i < n; ++i, ++expected)
+            ordered &= frame[i] == static_cast<test_data_t>(expected);
+
+        if (n == 0) std::this_thread::yield();
+    }
+
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(rb.ReadAvailable(), 0);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "Heph/ThreadPool.h"
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <stdexcept>
+
+using namespace Heph;
+
+TEST(HephTest, ThreadPool_Submit)
+{
+    {
+        ThreadPool pool(3);
+        EXPECT_EQ(pool.ThreadCount(), 3);
+
+        std::atomic<size_t> counter = 0;
+        for (size_t i = 0; i < 100; ++i)
+            pool.Submit([&counter]() { counter++; });
+
+        while (counter.load() < 100)
+        {
+            if (!pool.RunPendingTask()) std::this_thread::yield();
+        }
+        EXPECT_EQ(counter.load(), 100);
+
+        // exceptions do not stop the workers
+        pool.Submit([]() { throw std::runtime_error("task failed"); });
+        pool.Submit([&counter]() { counter++; });
+        while (counter.load() < 101)
+        {
+            if (!pool.RunPendingTask()) std::this_thread::yield();
+        }
+    }
+
+    {
+        ThreadPool pool(0);
+        EXPECT_EQ(pool.ThreadCount(), 0);
+
+        size_t counter = 0;
+        pool.Submit([&counter]() { counter++; });
+        EXPECT_EQ(counter, 1);
+        EXPECT_FALSE(pool.RunPendingTask());
+    }
+
+    {
+        // remaining tasks are executed before the pool is destroyed
+        std::atomic<size_t> counter = 0;
+        {
+            ThreadPool pool(2);
+            for (size_t i = 0; i < 50; ++i)
+                pool.Submit([&counter]() { counter++; });
+        }
+        EXPECT_EQ(counter.load(), 50);
+    }
+}
+
+TEST(HephTest, ThreadPool_For)
+{
+    ThreadPool pool(3);
+
+    {
+        std::vector<size_t> v(1000, 0);
+        std::atomic<size_t> callCount = 0;
+        pool.For(0, v.size(), 10, [&v, &callCount](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    v[i] += i;
+                callCount++;
+            });
+
+        for (size_t i = 0; i < v.size(); ++i)
+            EXPECT_EQ(v[i], i);
+        EXPECT_GT(callCount.load(), 1);
+        EXPECT_LE(callCount.load(), 100);
+    }
+
+    {
+        size_t callCount = 0;
+        pool.For(0, 1000, 10, [&callCount](size_t begin, size_t end)
+            {
+                EXPECT_EQ(begin, 0);
+                EXPECT_EQ(end, 1000);
+                callCount++;
+            }, 1);
+        EXPECT_EQ(callCount, 1);
+
+        pool.For(3, 3, 1, [&callCount](size_t, size_t) { callCount++; });
+        EXPECT_EQ(callCount, 1);
+    }
+
+    {
+        // nested loops run on the same workers without blocking them
+        std::vector<std::vector<size_t>> v(16, std::vector<size_t>(256, 0));
+        pool.For(0, v.size(), 1, [&pool, &v](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    pool.For(0, v[i].size(), 16, [&v, i](size_t innerBegin, size_t innerEnd)
+                        {
+                            for (size_t j = innerBegin; j < innerEnd; ++j)
+                                v[i][j] = i * j;
+                        });
+                }
+            });
+
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            for (size_t j = 0; j < v[i].size(); ++j)
+                EXPECT_EQ(v[i][j], i * j);
+        }
+    }
+
+    {
+        std::atomic<size_t> processedCount = 0;
+        EXPECT_THROW(pool.For(0, 100, 1, [&processedCount](size_t begin, size_t end)
+            {
+                if (begin > 0) throw std::runtime_error("chunk failed");
+                processedCount += end - begin;
+            }), std::runtime_error);
+        EXPECT_GT(processedCount.load(), 0);
+    }
+}